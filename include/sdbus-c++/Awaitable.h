@@ -0,0 +1,207 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Awaitable.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_AWAITABLE_H_
+#define SDBUS_CXX_AWAITABLE_H_
+
+#include <sdbus-c++/Error.h>
+#include <sdbus-c++/Message.h>
+#include <sdbus-c++/TypeTraits.h>
+
+#ifdef __has_include
+#  if __has_include(<coroutine>)
+#    include <coroutine>
+#  endif
+#endif
+
+#ifdef __cpp_lib_coroutine
+
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+namespace sdbus {
+
+    /********************************************//**
+     * @class Awaitable
+     *
+     * Awaitable is a handle of an asynchronous D-Bus method call that can be
+     * `co_await`ed in a C++20 coroutine. The call is sent when the awaitable is
+     * awaited. The awaiting coroutine is suspended until the reply arrives, and then
+     * `co_await` evaluates to void, to a single value, or to a tuple of values,
+     * depending on the number of Args, or it throws sdbus::Error if the call failed.
+     *
+     * By default, the coroutine is resumed in the context of the connection's event
+     * loop thread, right from within the reply callback. With resumeOn(), it is
+     * resumed via the provided executor instead.
+     *
+     * The state of the pending call lives in the awaitable itself, which lives in
+     * the coroutine frame, so unlike getResultAsFuture(), the call allocates no
+     * callback, promise or shared state. Destroying a suspended coroutine cancels
+     * the pending call, just like destroying the slot of a return_slot call does.
+     *
+     ***********************************************/
+    template <typename... Args>
+    class [[nodiscard]] Awaitable : private AsyncReplyReceiver
+    {
+        static_assert( !borrows_message_data_v<Args...>
+                     , "Results pointing into the reply (like std::string_view or std::span<const T>) would dangle once it is destroyed, use std::string instead" );
+
+    public:
+        using result_type = future_return_t<Args...>;
+
+        Awaitable(MethodCall call, uint64_t timeout);
+        Awaitable(const Awaitable&) = delete;
+        Awaitable& operator=(const Awaitable&) = delete;
+        Awaitable(Awaitable&& other) noexcept; // Only before being co_awaited, then it's the reply callback context
+        Awaitable& operator=(Awaitable&&) = delete;
+        ~Awaitable() = default;
+
+        /*!
+         * @brief Makes the awaiting coroutine resume via the given executor
+         *
+         * @param[in] executor Any object with a `post()` member function taking a `void()` callable
+         *
+         * The executor must outlive the pending call. If the reply arrives even before
+         * the coroutine gets suspended, the coroutine simply continues without suspension.
+         */
+        template <typename Executor>
+        Awaitable resumeOn(Executor& executor) &&;
+
+        bool await_ready() const noexcept;
+        bool await_suspend(std::coroutine_handle<> continuation);
+        result_type await_resume();
+
+    private:
+        enum class State { Sending, Suspended, Completed };
+
+        void onReply(MethodReply reply, std::optional<Error> error) override;
+
+        MethodCall call_;
+        uint64_t timeout_;
+        Slot slot_;
+        MethodReply reply_;
+        std::optional<Error> error_;
+        std::coroutine_handle<> continuation_;
+        void* executor_{};
+        void (*post_)(void* executor, std::coroutine_handle<> continuation){};
+        // Resolves the race between the reply arriving in the event loop thread and the coroutine getting suspended
+        std::atomic<State> state_{State::Sending};
+    };
+
+    template <typename... Args>
+    inline Awaitable<Args...>::Awaitable(MethodCall call, uint64_t timeout)
+        : call_(std::move(call))
+        , timeout_(timeout)
+    {
+    }
+
+    template <typename... Args>
+    inline Awaitable<Args...>::Awaitable(Awaitable&& other) noexcept
+        : AsyncReplyReceiver(other)
+        , call_(std::move(other.call_))
+        , timeout_(other.timeout_)
+        , executor_(other.executor_)
+        , post_(other.post_)
+    {
+        assert(other.slot_ == nullptr); // The call must not be in flight
+    }
+
+    template <typename... Args>
+    template <typename Executor>
+    inline Awaitable<Args...> Awaitable<Args...>::resumeOn(Executor& executor) &&
+    {
+        executor_ = &executor;
+        post_ = [](void* executor, std::coroutine_handle<> continuation)
+        {
+            static_cast<Executor*>(executor)->post([continuation](){ continuation.resume(); });
+        };
+
+        return std::move(*this);
+    }
+
+    template <typename... Args>
+    inline bool Awaitable<Args...>::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename... Args>
+    inline bool Awaitable<Args...>::await_suspend(std::coroutine_handle<> continuation)
+    {
+        SDBUS_THROW_ERROR_IF(!call_.isValid(), "Invalid async method call message provided", EINVAL);
+
+        continuation_ = continuation;
+        slot_ = call_.send(*this, timeout_, return_slot);
+
+        // Once we are in the suspended state, the event loop thread may resume (and even destroy) the coroutine at any time
+        auto expected = State::Sending;
+        return state_.compare_exchange_strong(expected, State::Suspended);
+    }
+
+    template <typename... Args>
+    inline typename Awaitable<Args...>::result_type Awaitable<Args...>::await_resume()
+    {
+        if (error_)
+            throw *std::move(error_);
+
+        if constexpr (sizeof...(Args) > 0)
+        {
+            std::tuple<Args...> results;
+            reply_ >> results;
+
+            if constexpr (sizeof...(Args) == 1)
+                return std::move(std::get<0>(results));
+            else
+                return results;
+        }
+    }
+
+    template <typename... Args>
+    inline void Awaitable<Args...>::onReply(MethodReply reply, std::optional<Error> error)
+    {
+        reply_ = std::move(reply);
+        error_ = std::move(error);
+
+        if (state_.exchange(State::Completed) != State::Suspended)
+            return; // The coroutine is not suspended yet, and await_suspend() will not suspend it now
+
+        // Nothing of this object may be touched after the resumption
+        if (post_ != nullptr)
+            post_(executor_, continuation_);
+        else
+            continuation_.resume();
+    }
+
+} // namespace sdbus
+
+#endif /* __cpp_lib_coroutine */
+
+#endif /* SDBUS_CXX_AWAITABLE_H_ */
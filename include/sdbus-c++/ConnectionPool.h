@@ -0,0 +1,158 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file ConnectionPool.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_CONNECTIONPOOL_H_
+#define SDBUS_CXX_CONNECTIONPOOL_H_
+
+#include <sdbus-c++/IConnection.h>
+#include <sdbus-c++/Types.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace sdbus {
+
+    /********************************************//**
+     * @class ConnectionPool
+     *
+     * A set of D-Bus connections (shards), each served by its own internal event loop
+     * thread, optionally pinned to a CPU core. A single connection processes its messages
+     * sequentially in its event loop thread over one socket, so spreading objects and
+     * proxies over several connections lets their traffic be processed in parallel.
+     *
+     * Objects and proxies are assigned to shards by a sharding policy, based on object path.
+     * The default policy hashes the object path. getConnectionFor() routes an object path
+     * to the connection of its shard.
+     *
+     * Note that each shard is a separate D-Bus connection with its own unique bus name.
+     * A well-known name can only be owned by one connection, so objects that shall be
+     * reachable by a well-known name must be placed on the connection that owns it.
+     *
+     ***********************************************/
+    class ConnectionPool
+    {
+    public:
+        using ConnectionFactory = std::function<std::unique_ptr<IConnection>()>;
+        using ShardingPolicy = std::function<std::size_t(const ObjectPath& objectPath, std::size_t shardCount)>;
+
+        /*!
+         * @brief Opens the given number of connections
+         *
+         * @param[in] shardCount Number of connections in the pool
+         * @param[in] connectionFactory Function that creates each of the connections (createBusConnection() by default)
+         * @param[in] shardingPolicy Function that assigns object paths to shards (hashObjectPath() by default)
+         *
+         * @throws sdbus::Error in case of failure (e.g. zero shard count)
+         */
+        explicit ConnectionPool( std::size_t shardCount
+                               , ConnectionFactory connectionFactory = {}
+                               , ShardingPolicy shardingPolicy = {} );
+        ConnectionPool(const ConnectionPool&) = delete;
+        ConnectionPool& operator=(const ConnectionPool&) = delete;
+        ConnectionPool(ConnectionPool&&) = delete;
+        ConnectionPool& operator=(ConnectionPool&&) = delete;
+
+        /*!
+         * @brief Leaves the event loops, if running, and closes the connections
+         */
+        ~ConnectionPool();
+
+        /*!
+         * @brief Runs an internal event loop for each connection, each in its own thread
+         *
+         * @param[in] pinToCores Whether to pin the event loop threads to CPU cores
+         *
+         * If pinning is requested, the event loop thread of shard i is pinned to the i-th CPU core
+         * of the cores the process is allowed to run on (modulo their count). Pinning is best effort:
+         * should it fail, the thread keeps running unpinned.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        void enterEventLoopsAsync(bool pinToCores = true);
+
+        /*!
+         * @brief Leaves the internal event loops of all connections, and joins their threads
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        void leaveEventLoops();
+
+        /*!
+         * @brief Gets the number of connections in the pool
+         */
+        [[nodiscard]] std::size_t size() const;
+
+        /*!
+         * @brief Gets the connection of the given shard
+         *
+         * @param[in] shard Shard index, less than size()
+         * @return Connection of the shard
+         *
+         * @throws sdbus::Error in case of failure (e.g. shard index out of range)
+         */
+        [[nodiscard]] IConnection& getConnection(std::size_t shard) const;
+
+        /*!
+         * @brief Gets the shard the object path is assigned to by the sharding policy
+         *
+         * @param[in] objectPath Path of a local object, or of a remote object a proxy is to be created for
+         * @return Shard index
+         */
+        [[nodiscard]] std::size_t getShardFor(const ObjectPath& objectPath) const;
+
+        /*!
+         * @brief Gets the connection the object path is assigned to by the sharding policy
+         *
+         * @param[in] objectPath Path of a local object, or of a remote object a proxy is to be created for
+         * @return Connection to create the object or the proxy on
+         *
+         * Code example:
+         * @code
+         * sdbus::ConnectionPool pool(4);
+         * auto object = sdbus::createObject(pool.getConnectionFor(objectPath), objectPath);
+         * auto proxy = sdbus::createProxy(pool.getConnectionFor(remotePath), destination, remotePath);
+         * pool.enterEventLoopsAsync();
+         * @endcode
+         */
+        [[nodiscard]] IConnection& getConnectionFor(const ObjectPath& objectPath) const;
+
+        /*!
+         * @brief Default sharding policy, which assigns object paths to shards by their hash
+         */
+        [[nodiscard]] static std::size_t hashObjectPath(const ObjectPath& objectPath, std::size_t shardCount);
+
+    private:
+        std::vector<std::unique_ptr<IConnection>> connections_;
+        ShardingPolicy shardingPolicy_;
+        std::vector<std::thread> eventLoopThreads_;
+    };
+
+} // namespace sdbus
+
+#endif /* SDBUS_CXX_CONNECTIONPOOL_H_ */
@@ -27,6 +27,8 @@
 #ifndef SDBUS_CXX_CONVENIENCEAPICLASSES_H_
 #define SDBUS_CXX_CONVENIENCEAPICLASSES_H_
 
+#include <sdbus-c++/Awaitable.h>
+#include <sdbus-c++/Executor.h>
 #include <sdbus-c++/Message.h>
 #include <sdbus-c++/TypeTraits.h>
 #include <sdbus-c++/Types.h>
@@ -139,6 +141,10 @@ namespace sdbus {
         //                      or std::future<T> for single D-Bus method return value
         //                      or std::future<std::tuple<...>> for multiple method return values
         template <typename... Args> std::future<future_return_t<Args...>> getResultAsFuture();
+#ifdef __cpp_lib_coroutine
+        // Returned awaitable yields the same types as getResultAsFuture() above, when co_awaited
+        template <typename... Args> Awaitable<Args...> getResultAsAwaitable();
+#endif // __cpp_lib_coroutine
 
     private:
         friend IProxy;
@@ -158,6 +164,7 @@ namespace sdbus {
         SignalSubscriber& onInterface(const InterfaceName& interfaceName);
         SignalSubscriber& onInterface(const std::string& interfaceName);
         SignalSubscriber& onInterface(const char* interfaceName);
+        SignalSubscriber& withExecutor(Executor executor);
         template <typename Function> void call(Function&& callback);
         template <typename Function> [[nodiscard]] Slot call(Function&& callback, return_slot_t);
 
@@ -170,6 +177,7 @@ namespace sdbus {
         IProxy& proxy_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
         const char* signalName_;
         const char* interfaceName_{};
+        Executor executor_;
     };
 
     class PropertyGetter
@@ -194,6 +202,9 @@ namespace sdbus {
         template <typename Function> PendingAsyncCall uponReplyInvoke(Function&& callback);
         template <typename Function> [[nodiscard]] Slot uponReplyInvoke(Function&& callback, return_slot_t);
         std::future<Variant> getResultAsFuture();
+#ifdef __cpp_lib_coroutine
+        Awaitable<Variant> getResultAsAwaitable();
+#endif // __cpp_lib_coroutine
 
     private:
         friend IProxy;
@@ -235,6 +246,9 @@ namespace sdbus {
         template <typename Function> PendingAsyncCall uponReplyInvoke(Function&& callback);
         template <typename Function> [[nodiscard]] Slot uponReplyInvoke(Function&& callback, return_slot_t);
         std::future<void> getResultAsFuture();
+#ifdef __cpp_lib_coroutine
+        Awaitable<> getResultAsAwaitable();
+#endif // __cpp_lib_coroutine
 
     private:
         friend IProxy;
@@ -211,6 +211,8 @@ namespace sdbus {
     template <typename... Args>
     inline void MethodInvoker::storeResultsTo(Args&... args)
     {
+        static_assert( !borrows_message_data_v<Args...>
+                     , "Results pointing into the reply (like std::string_view or std::span<const T>) would dangle once it is destroyed, use std::string instead" );
         assert(method_.isValid()); // onInterface() must be placed/called prior to this function
 
         auto reply = proxy_.callMethod(method_, timeout_);
@@ -334,6 +336,9 @@ namespace sdbus {
     template <typename... Args>
     std::future<future_return_t<Args...>> AsyncMethodInvoker::getResultAsFuture()
     {
+        static_assert( !borrows_message_data_v<Args...>
+                     , "Results pointing into the reply (like std::string_view or std::span<const T>) would dangle once it is destroyed, use std::string instead" );
+
         auto promise = std::make_shared<std::promise<future_return_t<Args...>>>();
         auto future = promise->get_future();
 
@@ -354,6 +359,16 @@ namespace sdbus {
         return future;
     }
 
+#ifdef __cpp_lib_coroutine
+    template <typename... Args>
+    inline Awaitable<Args...> AsyncMethodInvoker::getResultAsAwaitable()
+    {
+        assert(method_.isValid()); // onInterface() must be placed/called prior to this function
+
+        return {method_, timeout_};
+    }
+#endif // __cpp_lib_coroutine
+
     /*** ---------------- ***/
     /*** SignalSubscriber ***/
     /*** ---------------- ***/
@@ -386,14 +401,27 @@ namespace sdbus {
         return *this;
     }
 
+    inline SignalSubscriber& SignalSubscriber::withExecutor(Executor executor)
+    {
+        executor_ = executor;
+
+        return *this;
+    }
+
     template <typename Function>
     inline void SignalSubscriber::call(Function&& callback)
     {
         assert(interfaceName_ != nullptr); // onInterface() must be placed/called prior to this function
 
-        proxy_.registerSignalHandler( interfaceName_
-                                    , signalName_
-                                    , makeSignalHandler(std::forward<Function>(callback)) );
+        if (!executor_)
+            proxy_.registerSignalHandler( interfaceName_
+                                        , signalName_
+                                        , makeSignalHandler(std::forward<Function>(callback)) );
+        else
+            proxy_.registerSignalHandler( interfaceName_
+                                        , signalName_
+                                        , makeSignalHandler(std::forward<Function>(callback))
+                                        , executor_ );
     }
 
     template <typename Function>
@@ -401,9 +429,16 @@ namespace sdbus {
     {
         assert(interfaceName_ != nullptr); // onInterface() must be placed/called prior to this function
 
+        if (!executor_)
+            return proxy_.registerSignalHandler( interfaceName_
+                                               , signalName_
+                                               , makeSignalHandler(std::forward<Function>(callback))
+                                               , return_slot );
+
         return proxy_.registerSignalHandler( interfaceName_
                                            , signalName_
                                            , makeSignalHandler(std::forward<Function>(callback))
+                                           , executor_
                                            , return_slot );
     }
 
@@ -524,6 +559,18 @@ namespace sdbus {
                      .getResultAsFuture<Variant>();
     }
 
+#ifdef __cpp_lib_coroutine
+    inline Awaitable<Variant> AsyncPropertyGetter::getResultAsAwaitable()
+    {
+        assert(!interfaceName_.empty()); // onInterface() must be placed/called prior to this function
+
+        return proxy_.callMethodAsync("Get")
+                     .onInterface(DBUS_PROPERTIES_INTERFACE_NAME)
+                     .withArguments(interfaceName_, propertyName_)
+                     .getResultAsAwaitable<Variant>();
+    }
+#endif // __cpp_lib_coroutine
+
     /*** -------------- ***/
     /*** PropertySetter ***/
     /*** -------------- ***/
@@ -640,6 +687,18 @@ namespace sdbus {
                      .getResultAsFuture<>();
     }
 
+#ifdef __cpp_lib_coroutine
+    inline Awaitable<> AsyncPropertySetter::getResultAsAwaitable()
+    {
+        assert(!interfaceName_.empty()); // onInterface() must be placed/called prior to this function
+
+        return proxy_.callMethodAsync("Set")
+                     .onInterface(DBUS_PROPERTIES_INTERFACE_NAME)
+                     .withArguments(interfaceName_, propertyName_, std::move(value_))
+                     .getResultAsAwaitable<>();
+    }
+#endif // __cpp_lib_coroutine
+
     /*** ------------------- ***/
     /*** AllPropertiesGetter ***/
     /*** ------------------- ***/
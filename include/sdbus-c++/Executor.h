@@ -0,0 +1,125 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Executor.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_EXECUTOR_H_
+#define SDBUS_CXX_EXECUTOR_H_
+
+#include <sdbus-c++/Message.h>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+// Forward declarations
+namespace sdbus::internal {
+    struct PostedCallbackGuard;
+    class ExecutorBinding;
+} // namespace sdbus::internal
+
+namespace sdbus {
+
+    /********************************************//**
+     * @class PostedCallback
+     *
+     * PostedCallback is a nullary callable that sdbus-c++ posts to an Executor
+     * in order to deliver an incoming D-Bus message to its callback handler
+     * (a signal handler, an async method call reply handler, or a match rule
+     * handler). It carries the message itself, plus a reference to the
+     * subscription it is delivered to. Invoking it runs the callback handler,
+     * unless the subscription has been cancelled since the callback was posted,
+     * in which case it does nothing. It is meant to be invoked once.
+     *
+     * Exceptions thrown from the callback handler are ignored, just like when the
+     * handler is invoked in the event loop thread.
+     *
+     ***********************************************/
+    class PostedCallback
+    {
+    public:
+        void operator()();
+
+    private:
+        friend internal::ExecutorBinding;
+        PostedCallback(std::shared_ptr<internal::PostedCallbackGuard> guard, Message message) noexcept;
+
+        std::shared_ptr<internal::PostedCallbackGuard> guard_;
+        Message message_;
+    };
+
+    /********************************************//**
+     * @class Executor
+     *
+     * Executor is a non-owning, type-erased reference to an object that runs
+     * callbacks on behalf of sdbus-c++. Any object with a `post()` member function
+     * taking a nullary callable qualifies, like a thread pool, a strand, or an event
+     * loop of an application framework. sdbus-c++ posts a PostedCallback to it for
+     * each incoming message, and the executor shall invoke the callback at some
+     * point in its own context. The referred object must outlive all subscriptions
+     * whose callbacks may be posted to it.
+     *
+     * A default-constructed executor is empty, and callbacks are invoked directly
+     * in the event loop thread of the connection.
+     *
+     ***********************************************/
+    class Executor
+    {
+    public:
+        Executor() = default;
+        template < typename T
+                 , typename = std::enable_if_t<!std::is_same_v<std::remove_cv_t<T>, Executor>> >
+        Executor(T& executor) noexcept; // NOLINT(google-explicit-constructor): executors are meant to be passed directly
+
+        void post(PostedCallback callback) const;
+        explicit operator bool() const noexcept;
+
+    private:
+        void* executor_{};
+        void (*post_)(void* executor, PostedCallback&& callback){};
+    };
+
+    template <typename T, typename>
+    inline Executor::Executor(T& executor) noexcept
+        : executor_(std::addressof(executor))
+        , post_([](void* executor, PostedCallback&& callback)
+                {
+                    static_cast<T*>(executor)->post(std::move(callback));
+                })
+    {
+    }
+
+    inline void Executor::post(PostedCallback callback) const
+    {
+        post_(executor_, std::move(callback));
+    }
+
+    inline Executor::operator bool() const noexcept
+    {
+        return post_ != nullptr;
+    }
+
+} // namespace sdbus
+
+#endif /* SDBUS_CXX_EXECUTOR_H_ */
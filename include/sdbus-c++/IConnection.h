@@ -27,10 +27,15 @@
 #ifndef SDBUS_CXX_ICONNECTION_H_
 #define SDBUS_CXX_ICONNECTION_H_
 
+#include <sdbus-c++/Executor.h>
 #include <sdbus-c++/TypeTraits.h>
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -221,6 +226,459 @@ namespace sdbus {
          */
         [[nodiscard]] virtual uint64_t getMethodCallTimeout() const = 0;
 
+        /*!
+         * @brief Enables or disables non-blocking synchronous method calls on the connection
+         *
+         * @param[in] enabled True to enable non-blocking synchronous method calls, false to disable them
+         *
+         * By default, a synchronous method call keeps the bus connection locked for the whole
+         * round trip, i.e. until the reply arrives or the call times out. Meanwhile, the event loop
+         * of the connection as well as all other threads working with the connection are blocked.
+         *
+         * When enabled, a synchronous method call issued from a thread other than the thread running
+         * the internal event loop of this connection (see enterEventLoop() and enterEventLoopAsync())
+         * is sent asynchronously, and the calling thread just waits for the reply, which is delivered
+         * to it by the event loop. The connection is thus free to dispatch other messages in the meantime.
+         * If no internal event loop is running on the connection, or the call is made from within
+         * the event loop thread (e.g. from a D-Bus callback handler), the call falls back to the
+         * default, blocking behavior.
+         *
+         * If the event loop is left while a non-blocking synchronous call waits for its reply,
+         * the call is aborted with sdbus::Error.
+         *
+         * Disabled by default. Not supported on single-threaded connections.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void setNonBlockingMethodCalls(bool enabled) = 0;
+
+        /*!
+         * @brief Tells whether non-blocking synchronous method calls are enabled on the connection
+         *
+         * @return True if non-blocking synchronous method calls are enabled, false otherwise
+         *
+         * See setNonBlockingMethodCalls() for more information.
+         */
+        [[nodiscard]] virtual bool areMethodCallsNonBlocking() const = 0;
+
+        /*!
+         * @brief Sets the number of worker threads that incoming D-Bus messages are dispatched to
+         *
+         * @param[in] threadCount Number of worker threads, or 0 to dispatch messages in the event loop thread
+         *
+         * By default (threadCount being 0), the event loop thread of the connection both reads incoming
+         * D-Bus messages and invokes their handlers. With a non-zero thread count, the event loop thread
+         * only reads the messages, and hands incoming method calls and signals over to a pool of
+         * threadCount work-stealing worker threads, where D-Bus method handlers and signal handlers
+         * are invoked. Replies to method calls are sent out from the worker threads. The handlers
+         * must thus be thread-safe, as they may run concurrently with each other. Other callbacks
+         * (property getters and setters, async method call reply handlers, match rule handlers)
+         * are still invoked in the event loop thread.
+         *
+         * Objects and proxies wait for their in-flight handlers to finish before they are destroyed.
+         * Therefore, a handler must not destroy its own object or proxy.
+         *
+         * This method shall be called before objects and proxies on this connection start receiving
+         * D-Bus messages, i.e. before an event loop is entered on the connection. Worker threads are
+         * not supported on single-threaded connections.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void setDispatchThreadCount(std::size_t threadCount) = 0;
+
+        /*!
+         * @brief Gets the number of worker threads that incoming D-Bus messages are dispatched to
+         *
+         * @return Number of worker threads, 0 if messages are dispatched in the event loop thread
+         *
+         * See setDispatchThreadCount() for more information.
+         */
+        [[nodiscard]] virtual std::size_t getDispatchThreadCount() const = 0;
+
+        /*!
+         * @brief Adds a file descriptor to be watched by the internal event loop of the connection
+         *
+         * @param[in] fd File descriptor to watch
+         * @param[in] events Events to watch for, as in poll(2) (POLLIN, POLLOUT, POLLPRI)
+         * @param[in] callback Callback handler to be called with the received events (incl. POLLERR or POLLHUP)
+         * @return RAII-style slot handle representing the ownership of the watch
+         *
+         * This allows an application to serve its own file descriptors, e.g. sockets, in the same
+         * event loop thread as the D-Bus connection, without running another event loop. The watch
+         * is level-triggered, so the callback is invoked in each event loop iteration until the
+         * condition is handled. The watch does not take ownership of the file descriptor; destroying
+         * the returned slot removes the watch, and it shall happen before the file descriptor is closed.
+         *
+         * Watches are served only by the internal event loop (see enterEventLoop() and enterEventLoopAsync()),
+         * not by external event loops nor by an sd-event loop the connection is attached to.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        [[nodiscard]] virtual Slot addFdWatch(int fd, short int events, fd_watch_handler callback, return_slot_t) = 0;
+
+        /*!
+         * @brief Adds a periodic timer to the internal event loop of the connection
+         *
+         * @param[in] interval Timer period
+         * @param[in] callback Callback handler to be called upon each timer expiration
+         * @return RAII-style slot handle representing the ownership of the timer
+         *
+         * The timer first expires one interval after it's been added, and then periodically,
+         * until the returned slot is destroyed. The callback is invoked in the event loop thread.
+         * Multiple expirations that happen before the callback gets to run are coalesced into one call.
+         *
+         * Timers are served only by the internal event loop (see enterEventLoop() and enterEventLoopAsync()),
+         * not by external event loops nor by an sd-event loop the connection is attached to.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        [[nodiscard]] virtual Slot addTimer(std::chrono::microseconds interval, timer_handler callback, return_slot_t) = 0;
+
+        /*!
+         * @brief I/O multiplexing mechanism the internal event loop waits for events with
+         */
+        enum class EventLoopBackend : uint8_t
+        {
+            Epoll,  //!< Default. fds stay registered in epoll, each iteration makes one epoll_wait() call.
+            IoUring //!< Readiness polls are (re-)submitted and waited for in one io_uring_enter() call.
+        };
+
+        /*!
+         * @brief Selects the I/O multiplexing mechanism of the internal event loop
+         *
+         * @param[in] backend Requested event loop backend
+         *
+         * EventLoopBackend::IoUring is available only if sdbus-c++ has been built with
+         * SDBUSCPP_ENABLE_IO_URING, and the kernel supports and allows io_uring (Linux 5.11 or newer).
+         * Otherwise the connection falls back to EventLoopBackend::Epoll. getEventLoopBackend()
+         * tells which backend is actually in use.
+         *
+         * The backend must be selected before the event loop is entered. It has no effect on
+         * external event loops.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void setEventLoopBackend(EventLoopBackend backend) = 0;
+
+        /*!
+         * @brief Gets the I/O multiplexing mechanism the internal event loop uses
+         *
+         * @return Event loop backend in use
+         *
+         * See setEventLoopBackend() for more information.
+         */
+        [[nodiscard]] virtual EventLoopBackend getEventLoopBackend() const = 0;
+
+        /*!
+         * @brief Limits of the work the internal event loop does per wake-up
+         */
+        struct DispatchBudget
+        {
+            std::size_t maxMessages; //!< Maximum number of messages processed before polling again
+            std::chrono::microseconds maxDuration; //!< Maximum time spent processing messages before polling again
+        };
+
+        /*!
+         * @brief Sets how many messages the internal event loop processes per wake-up
+         *
+         * @param[in] budget Maximum number of messages and maximum processing time per wake-up
+         *
+         * When woken up, the internal event loop processes pending messages one after another
+         * until the queue is empty, or until either limit of the budget is reached, and only then
+         * polls again. This saves a system call and a poll data round trip per message under bursts
+         * of messages. A request to leave the event loop, or a wake-up request from another thread,
+         * ends the batch early. So do the limits, so that a flood of messages does not keep the event
+         * loop from serving timers and fd watches (see addTimer() and addFdWatch()) for too long.
+         *
+         * The default budget is 64 messages and 1 millisecond. A budget of one message makes the
+         * event loop poll after each message. The budget may be changed at any time, it applies
+         * from the next wake-up on. It has no effect on external event loops.
+         *
+         * @throws sdbus::Error in case of failure (e.g. zero maxMessages)
+         */
+        virtual void setDispatchBudget(const DispatchBudget& budget) = 0;
+
+        /*!
+         * @brief Gets the limits of the work the internal event loop does per wake-up
+         *
+         * @return Dispatch budget in use
+         *
+         * See setDispatchBudget() for more information.
+         */
+        [[nodiscard]] virtual DispatchBudget getDispatchBudget() const = 0;
+
+        /*!
+         * @brief Sets for how long the internal event loop busy-polls for further messages before going to sleep
+         *
+         * @param[in] window Busy-poll window, or zero to disable busy polling
+         *
+         * By default, the internal event loop goes to sleep in poll as soon as it has processed all pending
+         * messages, and a subsequent message wakes it up again. For latency-critical services, the wake-up
+         * may take a substantial part of a short method call round trip. With a non-zero busy-poll window,
+         * the event loop keeps checking the bus socket for new messages, without sleeping, for the given time
+         * after it has processed a message, and only then falls back to sleeping in poll. A message arriving
+         * within the window is thus processed right away, at the cost of the event loop thread burning
+         * a CPU core while spinning. The event loop only spins after having processed a message, so an idle
+         * connection doesn't burn any CPU. An exit or a wake-up request ends the spinning right away, but
+         * fd watches and timers (see addFdWatch() and addTimer()) are only served once it ends, so the window
+         * shall be kept short, typically tens to hundreds of microseconds.
+         *
+         * Spinning locks the bus connection repeatedly, so busy polling works best on connections used by the
+         * event loop thread only, like single-threaded connections. The window may be changed at any time, it
+         * applies from the next processed message on. It has no effect on external event loops.
+         *
+         * @throws sdbus::Error in case of failure (e.g. negative window)
+         */
+        virtual void setBusyPollWindow(std::chrono::microseconds window) = 0;
+
+        /*!
+         * @brief Gets for how long the internal event loop busy-polls for further messages before going to sleep
+         *
+         * @return Busy-poll window, zero if busy polling is disabled
+         *
+         * See setBusyPollWindow() for more information.
+         */
+        [[nodiscard]] virtual std::chrono::microseconds getBusyPollWindow() const = 0;
+
+        /*!
+         * @brief Bounds of the outbound message queue of the connection
+         */
+        struct OutboundQueueWatermarks
+        {
+            std::size_t high; //!< Queue length at which the queue becomes congested, or zero for an unbounded queue
+            std::size_t low; //!< Queue length at which a congested queue is considered drained again
+        };
+
+        /*!
+         * @brief Sets the watermarks of the outbound message queue
+         *
+         * @param[in] watermarks High and low watermark of the outbound queue length, in messages
+         *
+         * Outgoing messages that cannot be written to the bus socket right away, because the bus
+         * daemon or the peer is not keeping up, wait in the outbound queue of the connection until
+         * the event loop sends them out. By default, the queue is unbounded, so a fast producer of
+         * signals grows memory without limit. With watermarks set, the queue becomes congested when
+         * its length reaches the high watermark, and stays congested until the event loop drains it
+         * down to the low watermark. The handler set by setOutboundQueueHandler() is notified of both
+         * transitions, so producers may pause and resume, and Signal::trySend() refuses to enqueue
+         * messages while the queue length is at or above the high watermark, so producers may shed load.
+         *
+         * Watermarks only bound the queue for producers that cooperate. Messages sent by send() are
+         * always enqueued. A high watermark of zero makes the queue unbounded again, which ends
+         * a possible congestion. The watermarks may be changed at any time.
+         *
+         * @throws sdbus::Error in case of failure (e.g. low watermark not below high watermark)
+         */
+        virtual void setOutboundQueueWatermarks(const OutboundQueueWatermarks& watermarks) = 0;
+
+        /*!
+         * @brief Gets the watermarks of the outbound message queue
+         *
+         * @return Watermarks in use, with a zero high watermark if the queue is unbounded
+         *
+         * See setOutboundQueueWatermarks() for more information.
+         */
+        [[nodiscard]] virtual OutboundQueueWatermarks getOutboundQueueWatermarks() const = 0;
+
+        /*!
+         * @brief Sets the handler notified when the outbound message queue becomes congested or drained
+         *
+         * @param[in] handler Handler to notify, or an empty handler to notify nobody
+         *
+         * The handler is invoked with `true` when a sent message makes the outbound queue reach its
+         * high watermark, in the context of the thread sending the message, and with `false` once the
+         * queue has drained down to its low watermark, typically in the context of the event loop thread
+         * (see setOutboundQueueWatermarks()). Invocations of the handler never overlap and alternate
+         * between `true` and `false`. Transitions detected in other threads while the handler runs are
+         * delivered once it returns, so the handler always ends up seeing the latest state, though
+         * a quick congested-drained-congested sequence may be delivered as no invocation at all.
+         * The handler is invoked outside of any internal lock, so it may send messages itself, but it
+         * shall not block, since it delays the sending thread or the event loop.
+         */
+        virtual void setOutboundQueueHandler(outbound_queue_handler handler) = 0;
+
+        /*!
+         * @brief Gets the current number of messages in the outbound message queue
+         *
+         * @return Number of messages waiting to be sent out
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        [[nodiscard]] virtual std::size_t getOutboundQueueLength() const = 0;
+
+        /*!
+         * @brief Sends a batch of messages at once
+         *
+         * @param[in] messages Signals, method replies, or method calls not expecting a reply, to be sent in this order
+         * @param[in] count Number of the messages
+         *
+         * Sending a message locks the connection, and checks whether the event loop has to continue
+         * sending a message that could not be written out entirely. sendBatch() does so only once per
+         * batch, which pays off when sending many small signals or replies in a tight loop. sd-bus
+         * still writes each message to the bus socket by a separate system call, though.
+         *
+         * If the calling thread has corked the connection (see cork()), the messages are queued in the cork.
+         *
+         * @throws sdbus::Error in case of failure, in which case the messages after the failed one are not sent
+         */
+        virtual void sendBatch(const Message* messages, std::size_t count) = 0;
+
+        /*!
+         * @copydoc IConnection::sendBatch(const Message*,std::size_t)
+         */
+        void sendBatch(const std::vector<Message>& messages);
+
+#ifdef __cpp_lib_span
+        /*!
+         * @copydoc IConnection::sendBatch(const Message*,std::size_t)
+         */
+        void sendBatch(std::span<const Message> messages);
+#endif
+
+        /*!
+         * @brief Corks the connection in the calling thread
+         *
+         * @return RAII handle whose destruction sends the messages queued in the meantime
+         *
+         * While the cork lives, messages sent through this connection by the calling thread (like
+         * emitted signals and sent method replies) are queued instead of being sent right away.
+         * Destroying the cork sends them all in one batch, see sendBatch(). Other threads are not
+         * affected. Method calls expecting a reply are not queued, so they may overtake queued messages.
+         *
+         * The cork shall be destroyed in the thread that has created it. A nested cork of a connection
+         * already corked by the calling thread is empty, so the outermost cork sends the messages.
+         * Failures of sending the queued messages are not reported; use sendBatch() if they matter.
+         */
+        [[nodiscard]] virtual Slot cork() = 0;
+
+        /*!
+         * @brief Snapshot of runtime statistics of the connection
+         */
+        struct Statistics
+        {
+            /*!
+             * Log-bucketed histogram of durations: bucket 0 counts durations below 1 microsecond,
+             * bucket i counts durations from 2^(i-1) up to 2^i microseconds, and the last bucket
+             * counts all longer durations as well.
+             */
+            using Histogram = std::array<uint64_t, 32>;
+
+            struct MessageCounts
+            {
+                uint64_t methodCalls; //!< Number of method call messages
+                uint64_t methodReplies; //!< Number of method reply messages
+                uint64_t methodErrors; //!< Number of method error reply messages
+                uint64_t signals; //!< Number of signal messages
+            };
+
+            MessageCounts received; //!< Messages dispatched by the connection
+            MessageCounts sent; //!< Messages sent through the connection
+            uint64_t pollWakeups; //!< Number of times the internal event loop woke up from poll
+            uint64_t spuriousWakeups; //!< Number of wake-ups through the event fd with no message to process
+            std::chrono::nanoseconds handlerTime; //!< Total time spent in message dispatch, i.e. in handlers
+            std::size_t maxReadQueueLength; //!< Largest number of messages seen waiting in the inbound queue
+            std::size_t maxWriteQueueLength; //!< Largest number of messages seen waiting in the outbound queue
+            Histogram dispatchLatency; //!< Time from the event loop picking a message up to the start of its dispatch
+            Histogram handlerDuration; //!< Time the dispatch of a message takes
+        };
+
+        /*!
+         * @brief Gets runtime statistics of the connection
+         *
+         * @return Snapshot of the statistics counters
+         *
+         * The connection keeps statistics counters all the time, at the cost of a few relaxed atomic
+         * increments and clock readings per message. They may be read from any thread, e.g. by a metrics
+         * exporter. Each counter is read atomically, but the snapshot as a whole is not, so counters may
+         * be slightly out of step with each other under load.
+         *
+         * The dispatch latency of a message is measured from the moment the event loop starts processing
+         * messages after a wake-up (or from the processPendingEvent() call, in case of an external event
+         * loop) to the moment sd-bus starts dispatching the message, so it includes the time the message
+         * has waited for the messages processed before it. The handler duration is measured from then
+         * on until sd-bus returns. For messages dispatched to worker threads (see setDispatchThreadCount()),
+         * it covers the hand-over to a worker thread only. Replies to async method calls (and to non-blocking
+         * synchronous ones, see setNonBlockingMethodCalls()) are counted and timed like any other message.
+         * Replies to blocking synchronous method calls are read by the calling thread, not dispatched, so
+         * they are not counted as received messages.
+         */
+        [[nodiscard]] virtual Statistics getStatistics() const = 0;
+
+        /*!
+         * @brief Message whose dispatch has been running for longer than the watchdog threshold
+         */
+        struct DispatchStall
+        {
+            std::string interfaceName; //!< Interface of the method call or signal
+            std::string memberName; //!< Method or signal name
+            std::string objectPath; //!< Object path of the method call or signal
+            std::string sender; //!< Unique bus name of the sender
+            std::chrono::microseconds duration; //!< For how long the dispatch has been running when detected
+        };
+        using dispatch_stall_handler = std::function<void(const DispatchStall& stall)>;
+
+        /*!
+         * @brief Sets up a watchdog detecting message handlers that stall the connection
+         *
+         * @param[in] threshold Dispatch duration considered a stall, or zero to turn the watchdog off
+         * @param[in] handler Handler to report stalls to, may be empty to only count them
+         *
+         * A single slow method or signal handler holds up all other messages of the connection.
+         * The watchdog is a separate thread that checks, at half the threshold interval, how long the
+         * dispatch of the message that is currently being processed has been running. When it exceeds
+         * the threshold, the watchdog reports the message by calling the handler, in the context of the
+         * watchdog thread, while the slow handler is still running. Each stalled dispatch is reported
+         * once, and counted per member, see getDispatchStallCounts().
+         *
+         * Only dispatches in the event loop thread are watched, so for messages dispatched to worker
+         * threads (see setDispatchThreadCount()), just the hand-over to a worker thread is. The watchdog
+         * may be reconfigured or turned off at any time. The handler shall not throw.
+         *
+         * @throws sdbus::Error in case of failure (e.g. negative threshold)
+         */
+        virtual void setDispatchWatchdog(std::chrono::microseconds threshold, dispatch_stall_handler handler) = 0;
+
+        /*!
+         * @brief Gets the numbers of stalled dispatches detected by the watchdog
+         *
+         * @return Numbers of stalls keyed by `interface.member` of the stalled messages
+         *
+         * See setDispatchWatchdog() for more information.
+         */
+        [[nodiscard]] virtual std::map<std::string, uint64_t> getDispatchStallCounts() const = 0;
+
+        /*!
+         * @brief Sets the executor that callbacks of this connection are posted to
+         *
+         * @param[in] executor Executor to post callbacks to, or an empty executor to invoke them in the event loop thread
+         *
+         * By default, signal handlers, async method call reply handlers, and match rule handlers are invoked
+         * in the event loop thread of the connection. With an executor set, the event loop thread only
+         * posts them, together with their D-Bus messages, to the executor instead. An executor may be any
+         * object with a `post()` member function taking a nullary callable, see Executor for details.
+         * The handlers then run in the context of the executor, so they shall not rely on
+         * getCurrentlyProcessedMessage().
+         *
+         * The executor applies to subscriptions made, and async method calls made, after this call.
+         * It may be set from any thread, also while the event loop is running.
+         * A proxy (see IProxy::setCallbackExecutor()), or an individual signal handler or match rule,
+         * may still specify its own executor, which then takes precedence.
+         *
+         * Callbacks still queued in the executor when their subscription is cancelled are not invoked
+         * anymore. Cancelling a subscription waits for its callback that is just being run by the executor.
+         * D-Bus method handlers and property handlers of objects are not affected by the executor.
+         */
+        virtual void setCallbackExecutor(Executor executor) = 0;
+
+        /*!
+         * @brief Gets the executor that callbacks of this connection are posted to
+         *
+         * @return Executor of the connection, or an empty executor if none is set
+         *
+         * See setCallbackExecutor() for more information.
+         */
+        [[nodiscard]] virtual Executor getCallbackExecutor() const = 0;
+
         /*!
          * @brief Adds an ObjectManager at the specified D-Bus object path
          * @param[in] objectPath Object path at which the ObjectManager interface shall be installed
@@ -351,6 +809,37 @@ namespace sdbus {
                                                 , message_handler installCallback
                                                 , return_slot_t ) = 0;
 
+        /*!
+         * @brief Installs a floating match rule whose callback is invoked by the given executor
+         *
+         * @param[in] match Match expression to filter incoming D-Bus message
+         * @param[in] callback Callback handler to be called upon processing an inbound D-Bus message matching the rule
+         * @param[in] executor Executor that the callback handler is posted to
+         *
+         * The same as `addMatch()` without an executor, except that the callback handler is posted to
+         * the given executor, rather than to the executor of the connection. See setCallbackExecutor()
+         * for more information.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void addMatch(const std::string& match, message_handler callback, Executor executor) = 0;
+
+        /*!
+         * @brief Installs a match rule whose callback is invoked by the given executor
+         *
+         * @param[in] match Match expression to filter incoming D-Bus message
+         * @param[in] callback Callback handler to be called upon processing an inbound D-Bus message matching the rule
+         * @param[in] executor Executor that the callback handler is posted to
+         * @return RAII-style slot handle representing the ownership of the subscription
+         *
+         * The same as `addMatch()` without an executor, except that the callback handler is posted to
+         * the given executor, rather than to the executor of the connection. See setCallbackExecutor()
+         * for more information.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        [[nodiscard]] virtual Slot addMatch(const std::string& match, message_handler callback, Executor executor, return_slot_t) = 0;
+
         /*!
          * @brief Retrieves the unique name of a connection. E.g. ":1.xx"
          *
@@ -452,6 +941,23 @@ namespace sdbus {
      */
     [[nodiscard]] std::unique_ptr<IConnection> createBusConnection(const ServiceName& name);
 
+    /*!
+     * @brief Creates/opens single-threaded D-Bus session bus connection when in a user context, and a system bus connection, otherwise.
+     *
+     * @return Connection instance
+     *
+     * A single-threaded connection does not lock the underlying sd-bus instance, which saves a mutex
+     * lock on every operation on the bus, including creation, reference counting, and sending of messages.
+     * Such a connection must be used by one thread at a time only, typically by its own event loop thread
+     * (D-Bus callbacks included). The connection may be passed from one thread to another, for example
+     * set up in one thread and then served by enterEventLoopAsync(). Debug builds assert that the connection
+     * is not entered by two threads at once. Dispatching to worker threads and non-blocking synchronous
+     * method calls are not supported on single-threaded connections.
+     *
+     * @throws sdbus::Error in case of failure
+     */
+    [[nodiscard]] std::unique_ptr<IConnection> createBusConnection(single_threaded_t);
+
     /*!
      * @brief Creates/opens D-Bus system bus connection
      *
@@ -471,6 +977,17 @@ namespace sdbus {
      */
     [[nodiscard]] std::unique_ptr<IConnection> createSystemBusConnection(const ServiceName& name);
 
+    /*!
+     * @brief Creates/opens single-threaded D-Bus system bus connection
+     *
+     * @return Connection instance
+     *
+     * See createBusConnection(single_threaded_t) for more information on single-threaded connections.
+     *
+     * @throws sdbus::Error in case of failure
+     */
+    [[nodiscard]] std::unique_ptr<IConnection> createSystemBusConnection(single_threaded_t);
+
     /*!
      * @brief Creates/opens D-Bus session bus connection
      *
@@ -490,6 +1007,17 @@ namespace sdbus {
      */
     [[nodiscard]] std::unique_ptr<IConnection> createSessionBusConnection(const ServiceName& name);
 
+    /*!
+     * @brief Creates/opens single-threaded D-Bus session bus connection
+     *
+     * @return Connection instance
+     *
+     * See createBusConnection(single_threaded_t) for more information on single-threaded connections.
+     *
+     * @throws sdbus::Error in case of failure
+     */
+    [[nodiscard]] std::unique_ptr<IConnection> createSessionBusConnection(single_threaded_t);
+
     /*!
      * @brief Creates/opens D-Bus session bus connection at a custom address
      *
@@ -522,6 +1050,18 @@ namespace sdbus {
      */
     [[nodiscard]] std::unique_ptr<IConnection> createDirectBusConnection(const std::string& address);
 
+    /*!
+     * @brief Opens single-threaded direct D-Bus connection at a custom address
+     *
+     * @param[in] address ";"-separated list of addresses of bus brokers to try to connect to
+     * @return Connection instance
+     *
+     * See createBusConnection(single_threaded_t) for more information on single-threaded connections.
+     *
+     * @throws sdbus::Error in case of failure
+     */
+    [[nodiscard]] std::unique_ptr<IConnection> createDirectBusConnection(const std::string& address, single_threaded_t);
+
     /*!
      * @brief Opens direct D-Bus connection at the given file descriptor
      *
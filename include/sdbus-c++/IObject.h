@@ -32,6 +32,7 @@
 #include <sdbus-c++/TypeTraits.h>
 #include <sdbus-c++/VTableItems.h>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -309,6 +310,46 @@ namespace sdbus {
          */
         virtual void unregister() = 0;
 
+        /*!
+         * @brief Ordering of method calls of the object that are dispatched to worker threads
+         *
+         * See setDispatchOrdering() for more information.
+         */
+        enum class DispatchOrdering : uint8_t
+        {
+            Unordered,   //!< Method handlers of the object may run in parallel
+            PerObject,   //!< Method handlers of the object run one at a time, in the order of method calls
+            PerInterface //!< Same as PerObject, but separately for each vtable of the object
+        };
+
+        /*!
+         * @brief Sets ordering of method calls dispatched to worker threads of the connection
+         *
+         * @param[in] ordering Ordering of method calls
+         *
+         * This setting only takes effect when the connection dispatches incoming messages
+         * to worker threads (see IConnection::setDispatchThreadCount()). By default, handlers
+         * of method calls run in parallel, even if they belong to the same object. With
+         * DispatchOrdering::PerObject, method calls of the object form a serial queue (a strand):
+         * their handlers are invoked one at a time, in the order the calls arrived, while handlers
+         * of other objects still run in parallel. With DispatchOrdering::PerInterface, each vtable
+         * added to the object (see addVTable()) has its own strand.
+         *
+         * Replies of handlers that reply asynchronously, via Result<>, may still come in any order.
+         *
+         * The ordering shall be set before the object's vtables are added.
+         */
+        virtual void setDispatchOrdering(DispatchOrdering ordering) = 0;
+
+        /*!
+         * @brief Gets ordering of method calls dispatched to worker threads of the connection
+         *
+         * @return Ordering of method calls
+         *
+         * See setDispatchOrdering() for more information.
+         */
+        [[nodiscard]] virtual DispatchOrdering getDispatchOrdering() const = 0;
+
     // Lower-level, message-based API
         /*!
          * @brief Adds a declaration of methods, properties and signals of the object at a given interface
@@ -28,6 +28,7 @@
 #define SDBUS_CXX_IPROXY_H_
 
 #include <sdbus-c++/ConvenienceApiClasses.h>
+#include <sdbus-c++/Executor.h>
 #include <sdbus-c++/TypeTraits.h>
 
 #include <chrono>
@@ -350,6 +351,37 @@ namespace sdbus {
          */
         virtual void unregister() = 0;
 
+        /*!
+         * @brief Sets the executor that callbacks of this proxy are posted to
+         *
+         * @param[in] executor Executor to post callbacks to, or an empty executor to invoke them in the event loop thread
+         *
+         * By default, signal handlers and async method call reply handlers of the proxy are invoked
+         * in the event loop thread of the connection (or by the connection's executor, if it has one,
+         * see IConnection::setCallbackExecutor()). With an executor set on the proxy, the event loop
+         * thread only posts them, together with their D-Bus messages, to the executor instead.
+         * The handlers then run in the context of the executor, so they shall not rely on
+         * getCurrentlyProcessedMessage().
+         *
+         * The executor applies to signal handlers registered, and async method calls made, after this
+         * call. A signal handler may still specify its own executor, which then takes precedence.
+         * The executor may be set from any thread, also while the event loop is running.
+         *
+         * Callbacks still queued in the executor when their signal subscription or async call
+         * is cancelled are not invoked anymore. Cancelling a subscription waits for its callback
+         * that is just being run by the executor.
+         */
+        virtual void setCallbackExecutor(Executor executor) = 0;
+
+        /*!
+         * @brief Gets the executor that callbacks of this proxy are posted to
+         *
+         * @return Executor of the proxy, or an empty executor if none is set on the proxy
+         *
+         * See setCallbackExecutor() for more information.
+         */
+        [[nodiscard]] virtual Executor getCallbackExecutor() const = 0;
+
     // Lower-level, message-based API
         /*!
          * @brief Creates a method call message
@@ -645,6 +677,47 @@ namespace sdbus {
                                                         , signal_handler signalHandler
                                                         , return_slot_t ) = 0;
 
+        /*!
+         * @brief Registers a handler for the desired signal, to be invoked by the given executor
+         *
+         * @param[in] interfaceName Name of an interface that the signal belongs to
+         * @param[in] signalName Name of the signal
+         * @param[in] signalHandler Callback that implements the body of the signal handler
+         * @param[in] executor Executor that the signal handler is posted to
+         *
+         * The same as registerSignalHandler() without an executor, except that the signal handler
+         * is posted to the given executor, rather than to the executor of the proxy or the connection.
+         * See setCallbackExecutor() for more information.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void registerSignalHandler( const InterfaceName& interfaceName
+                                          , const SignalName& signalName
+                                          , signal_handler signalHandler
+                                          , Executor executor ) = 0;
+
+        /*!
+         * @brief Registers a handler for the desired signal, to be invoked by the given executor
+         *
+         * @param[in] interfaceName Name of an interface that the signal belongs to
+         * @param[in] signalName Name of the signal
+         * @param[in] signalHandler Callback that implements the body of the signal handler
+         * @param[in] executor Executor that the signal handler is posted to
+         *
+         * @return RAII-style slot handle representing the ownership of the subscription
+         *
+         * The same as registerSignalHandler() without an executor, except that the signal handler
+         * is posted to the given executor, rather than to the executor of the proxy or the connection.
+         * See setCallbackExecutor() for more information.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        [[nodiscard]] virtual Slot registerSignalHandler( const InterfaceName& interfaceName
+                                                        , const SignalName& signalName
+                                                        , signal_handler signalHandler
+                                                        , Executor executor
+                                                        , return_slot_t ) = 0;
+
     protected: // Internal API for efficiency reasons used by high-level API helper classes
         friend MethodInvoker;
         friend AsyncMethodInvoker;
@@ -658,6 +731,15 @@ namespace sdbus {
                                                         , const char* signalName
                                                         , signal_handler signalHandler
                                                         , return_slot_t ) = 0;
+        virtual void registerSignalHandler( const char* interfaceName
+                                          , const char* signalName
+                                          , signal_handler signalHandler
+                                          , Executor executor ) = 0;
+        [[nodiscard]] virtual Slot registerSignalHandler( const char* interfaceName
+                                                        , const char* signalName
+                                                        , signal_handler signalHandler
+                                                        , Executor executor
+                                                        , return_slot_t ) = 0;
     };
 
     /********************************************//**
@@ -37,6 +37,7 @@
 #include <cstring>
 #include <functional>
 #include <map>
+#include <optional>
 #ifdef __has_include
 #  if __has_include(<span>)
 #    include <span>
@@ -56,9 +57,12 @@ namespace sdbus {
     class Signature;
     template <typename... ValueTypes> class Struct;
     class UnixFd;
+    class SharedBuffer;
     class MethodReply;
     namespace internal {
         class IConnection;
+        struct MessageRefCount;
+        struct AsyncReplyDispatcher;
     } // namespace internal
 } // namespace sdbus
 
@@ -104,6 +108,7 @@ namespace sdbus {
         Message& operator<<(const ObjectPath &item);
         Message& operator<<(const Signature &item);
         Message& operator<<(const UnixFd &item);
+        Message& operator<<(const SharedBuffer &item);
         template <typename Element, typename Allocator>
         Message& operator<<(const std::vector<Element, Allocator>& items);
         template <typename Element, std::size_t Size>
@@ -137,17 +142,22 @@ namespace sdbus {
         Message& operator>>(double& item);
         Message& operator>>(char*& item);
         Message& operator>>(std::string &item);
+        // The view points into the message, so it is valid only as long as the message (or any copy of it) lives
+        Message& operator>>(std::string_view& item);
         Message& operator>>(Variant &item);
         template <typename ...Elements>
         Message& operator>>(std::variant<Elements...>& value);
         Message& operator>>(ObjectPath &item);
         Message& operator>>(Signature &item);
         Message& operator>>(UnixFd &item);
+        Message& operator>>(SharedBuffer &item);
         template <typename Element, typename Allocator>
         Message& operator>>(std::vector<Element, Allocator>& items);
         template <typename Element, std::size_t Size>
         Message& operator>>(std::array<Element, Size>& items);
 #ifdef __cpp_lib_span
+        // Copies into the span's storage, or, for a span of const elements of trivial D-Bus types,
+        // makes the span point right into the message, so it is valid only as long as the message lives
         template <typename Element, std::size_t Extent>
         Message& operator>>(std::span<Element, Extent>& items);
 #endif
@@ -256,6 +266,10 @@ namespace sdbus {
         void deserializeArrayFast(Array& items);
         template <typename Element, typename Allocator>
         void deserializeArrayFast(std::vector<Element, Allocator>& items);
+#ifdef __cpp_lib_span
+        template <typename Element, std::size_t Extent>
+        void deserializeArrayFast(std::span<const Element, Extent>& items);
+#endif
         template <typename Array>
         void deserializeArraySlow(Array& items);
         template <typename Element, typename Allocator>
@@ -272,6 +286,43 @@ namespace sdbus {
         void* msg_{};
         internal::IConnection* connection_{};
         mutable bool ok_{true};
+
+    private:
+        void release() noexcept;
+
+        internal::MessageRefCount* refCount_{}; // Shared by all copies of the message, null if it could not be allocated
+    };
+
+    /********************************************//**
+     * @class AsyncReplyReceiver
+     *
+     * AsyncReplyReceiver is a low-level receiver of an asynchronous method call reply.
+     * Unlike async_reply_handler, nothing is allocated per call: the receiver object
+     * itself is handed over to sd-bus as the reply callback context. Therefore, it must
+     * stay alive and in place until the reply arrives, or until the slot returned from
+     * MethodCall::send() is destroyed, whichever comes first.
+     *
+     * onReply() is invoked in the context of the connection's event loop thread.
+     *
+     ***********************************************/
+    class AsyncReplyReceiver
+    {
+    public:
+        virtual void onReply(MethodReply reply, std::optional<Error> error) = 0;
+
+    protected:
+        AsyncReplyReceiver() = default;
+        AsyncReplyReceiver(const AsyncReplyReceiver&) = default;
+        AsyncReplyReceiver& operator=(const AsyncReplyReceiver&) = default;
+        AsyncReplyReceiver(AsyncReplyReceiver&&) = default;
+        AsyncReplyReceiver& operator=(AsyncReplyReceiver&&) = default;
+        ~AsyncReplyReceiver() = default;
+
+    private:
+        friend MethodCall;
+        friend internal::AsyncReplyDispatcher;
+
+        internal::IConnection* connection_{}; // Connection of the pending call, for the reply message
     };
 
     class MethodCall : public Message
@@ -284,6 +335,7 @@ namespace sdbus {
 
         MethodReply send(uint64_t timeout) const;
         [[nodiscard]] Slot send(void* callback, void* userData, uint64_t timeout, return_slot_t) const;
+        [[nodiscard]] Slot send(AsyncReplyReceiver& receiver, uint64_t timeout, return_slot_t) const;
 
         MethodReply createReply() const;
         MethodReply createErrorReply(const Error& error) const;
@@ -320,6 +372,8 @@ namespace sdbus {
         void setDestination(const std::string& destination);
         void setDestination(const char* destination);
         void send() const;
+        // Returns false, not sending the signal, if the connection's outbound queue is at its high watermark
+        [[nodiscard]] bool trySend() const;
     };
 
     class PropertySetCall : public Message
@@ -546,6 +600,9 @@ namespace sdbus {
     template <typename Element, std::size_t Extent>
     inline Message& Message::operator>>(std::span<Element, Extent>& items)
     {
+        static_assert( !std::is_const_v<Element> || (signature_of<Element>::is_trivial_dbus_type && !std::is_same_v<Element, const bool>)
+                     , "Only spans of const elements of trivial D-Bus types other than bool can point into the message" );
+
         deserializeArray(items);
 
         return *this;
@@ -609,6 +666,28 @@ namespace sdbus {
         items.insert(items.end(), arrayPtr, arrayPtr + (arraySize / sizeof(Element)));
     }
 
+#ifdef __cpp_lib_span
+    template <typename Element, std::size_t Extent>
+    void Message::deserializeArrayFast(std::span<const Element, Extent>& items)
+    {
+        size_t arraySize{};
+        const Element* arrayPtr{};
+
+        constexpr auto signature = as_null_terminated(signature_of_v<Element>);
+        readArray(*signature.data(), reinterpret_cast<const void**>(&arrayPtr), &arraySize);
+        if (!*this)
+            return;
+
+        const size_t elementsInMsg = arraySize / sizeof(Element);
+        if constexpr (Extent != std::dynamic_extent)
+        {
+            SDBUS_THROW_ERROR_IF(elementsInMsg != Extent, "Failed to deserialize array: size does not match the destination span extent", EINVAL);
+        }
+
+        items = std::span<const Element, Extent>{arrayPtr, elementsInMsg};
+    }
+#endif
+
     template <typename Array>
     inline void Message::deserializeArraySlow(Array& items)
     {
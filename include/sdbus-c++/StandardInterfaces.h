@@ -173,6 +173,13 @@ namespace sdbus {
             return m_proxy.getPropertyAsync(propertyName).onInterface(interfaceName).getResultAsFuture();
         }
 
+#ifdef __cpp_lib_coroutine
+        Awaitable<Variant> GetAsync(const InterfaceName& interfaceName, const PropertyName& propertyName, with_awaitable_t)
+        {
+            return m_proxy.getPropertyAsync(propertyName).onInterface(interfaceName).getResultAsAwaitable();
+        }
+#endif // __cpp_lib_coroutine
+
         template <typename Function>
         PendingAsyncCall GetAsync(std::string_view interfaceName, std::string_view propertyName, Function&& callback)
         {
@@ -190,6 +197,13 @@ namespace sdbus {
             return m_proxy.getPropertyAsync(propertyName).onInterface(interfaceName).getResultAsFuture();
         }
 
+#ifdef __cpp_lib_coroutine
+        Awaitable<Variant> GetAsync(std::string_view interfaceName, std::string_view propertyName, with_awaitable_t)
+        {
+            return m_proxy.getPropertyAsync(propertyName).onInterface(interfaceName).getResultAsAwaitable();
+        }
+#endif // __cpp_lib_coroutine
+
         void Set(const InterfaceName& interfaceName, const PropertyName& propertyName, const Variant& value)
         {
             m_proxy.setProperty(propertyName).onInterface(interfaceName).toValue(value);
@@ -227,6 +241,13 @@ namespace sdbus {
             return m_proxy.setPropertyAsync(propertyName).onInterface(interfaceName).toValue(value).getResultAsFuture();
         }
 
+#ifdef __cpp_lib_coroutine
+        Awaitable<> SetAsync(const InterfaceName& interfaceName, const PropertyName& propertyName, const Variant& value, with_awaitable_t)
+        {
+            return m_proxy.setPropertyAsync(propertyName).onInterface(interfaceName).toValue(value).getResultAsAwaitable();
+        }
+#endif // __cpp_lib_coroutine
+
         template <typename Function>
         PendingAsyncCall SetAsync(std::string_view interfaceName, std::string_view propertyName, const Variant& value, Function&& callback)
         {
@@ -244,6 +265,13 @@ namespace sdbus {
             return m_proxy.setPropertyAsync(propertyName).onInterface(interfaceName).toValue(value).getResultAsFuture();
         }
 
+#ifdef __cpp_lib_coroutine
+        Awaitable<> SetAsync(std::string_view interfaceName, std::string_view propertyName, const Variant& value, with_awaitable_t)
+        {
+            return m_proxy.setPropertyAsync(propertyName).onInterface(interfaceName).toValue(value).getResultAsAwaitable();
+        }
+#endif // __cpp_lib_coroutine
+
         std::map<PropertyName, Variant> GetAll(const InterfaceName& interfaceName)
         {
             return m_proxy.getAllProperties().onInterface(interfaceName);
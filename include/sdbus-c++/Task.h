@@ -0,0 +1,293 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Task.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_TASK_H_
+#define SDBUS_CXX_TASK_H_
+
+#include <sdbus-c++/Error.h>
+#include <sdbus-c++/Message.h>
+
+#ifdef __has_include
+#  if __has_include(<coroutine>)
+#    include <coroutine>
+#  endif
+#endif
+
+#ifdef __cpp_lib_coroutine
+
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace sdbus {
+
+    template <typename T> class Task;
+
+    namespace detail {
+
+        template <typename T>
+        class TaskPromiseBase
+        {
+        public:
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    // Symmetric transfer to the awaiting coroutine, so that long chains of tasks don't grow the stack
+                    auto continuation = handle.promise().continuation_;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+            void unhandled_exception() noexcept { result_ = std::current_exception(); }
+            template <typename Value>
+            void return_value(Value&& value) { result_.template emplace<1>(std::forward<Value>(value)); }
+
+            T result()
+            {
+                if (auto* exception = std::get_if<std::exception_ptr>(&result_))
+                    std::rethrow_exception(*exception);
+                return std::move(std::get<1>(result_));
+            }
+
+        private:
+            friend FinalAwaiter;
+            template <typename> friend class sdbus::Task;
+
+            std::coroutine_handle<> continuation_;
+            std::variant<std::monostate, T, std::exception_ptr> result_;
+        };
+
+        template <>
+        class TaskPromiseBase<void>
+        {
+        public:
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    auto continuation = handle.promise().continuation_;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+            void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+            void return_void() const noexcept {}
+
+            void result()
+            {
+                if (exception_)
+                    std::rethrow_exception(exception_);
+            }
+
+        private:
+            friend FinalAwaiter;
+            template <typename> friend class sdbus::Task;
+
+            std::coroutine_handle<> continuation_;
+            std::exception_ptr exception_;
+        };
+
+        // Fire-and-forget coroutine, which starts right away and cleans up after itself when done
+        struct DetachedTask
+        {
+            struct promise_type
+            {
+                DetachedTask get_return_object() const noexcept { return {}; }
+                std::suspend_never initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                // Unreachable, since invoke_coroutine_method, the only DetachedTask coroutine, catches everything in its body
+                [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+
+        // Runs the coroutine-based server-side method and sends the reply, or the error reply, once it completes.
+        // Input arguments live in this coroutine frame, so the method may safely take them by reference. So does
+        // a copy of the callback, which thus stays valid even if the vtable is removed while the method is suspended
+        // (whatever the callback captures by reference, like the object, must still outlive the method, though).
+        template <typename ReturnType, typename Function, typename InputArgs>
+        DetachedTask invoke_coroutine_method(MethodCall call, Function callback, InputArgs inputArgs)
+        {
+            std::exception_ptr failure;
+
+            try
+            {
+                if constexpr (!std::is_void_v<ReturnType>)
+                {
+                    auto result = co_await std::apply(callback, inputArgs);
+                    auto reply = call.createReply();
+                    reply << result;
+                    reply.send();
+                }
+                else
+                {
+                    co_await std::apply(callback, inputArgs);
+                    call.createReply().send();
+                }
+                co_return;
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+            }
+
+            // Nothing may escape from here, since there is nobody to report it to
+            try
+            {
+                try
+                {
+                    std::rethrow_exception(failure);
+                }
+                catch (const Error& e)
+                {
+                    call.createErrorReply(e).send();
+                }
+                catch (const std::exception& e)
+                {
+                    call.createErrorReply(Error(SDBUSCPP_ERROR_NAME, e.what())).send();
+                }
+                catch (...)
+                {
+                    call.createErrorReply(Error(SDBUSCPP_ERROR_NAME, "Unknown error occurred")).send();
+                }
+            }
+            catch (...)
+            {
+                // The error reply can't be sent either, e.g. because the connection is gone. The caller gets a timeout.
+            }
+        }
+
+    } // namespace detail
+
+    /********************************************//**
+     * @class Task
+     *
+     * Task is a lazily started C++20 coroutine producing a value of type T.
+     * It starts running when it is co_awaited, and the awaiting coroutine is
+     * resumed as soon as the task completes, with the task's result or with the
+     * exception the task has thrown.
+     *
+     * Task is primarily the return type of coroutine-based server-side D-Bus method
+     * implementations. sdbus-c++ starts such a coroutine upon an incoming method
+     * call, and sends the method reply (or the error reply) when the coroutine
+     * completes. A suspended coroutine occupies no event loop thread.
+     *
+     ***********************************************/
+    template <typename T = void>
+    class [[nodiscard]] Task
+    {
+    public:
+        class promise_type : public detail::TaskPromiseBase<T>
+        {
+        public:
+            Task get_return_object() noexcept { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        };
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task(Task&& other) noexcept;
+        Task& operator=(Task&& other) noexcept;
+        ~Task();
+
+        bool await_ready() const noexcept;
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept;
+        T await_resume();
+
+    private:
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    template <typename T>
+    inline Task<T>::Task(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle)
+    {
+    }
+
+    template <typename T>
+    inline Task<T>::Task(Task&& other) noexcept
+        : handle_(std::exchange(other.handle_, {}))
+    {
+    }
+
+    template <typename T>
+    inline Task<T>& Task<T>::operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_)
+                handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+
+        return *this;
+    }
+
+    template <typename T>
+    inline Task<T>::~Task()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    template <typename T>
+    inline bool Task<T>::await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <typename T>
+    inline std::coroutine_handle<> Task<T>::await_suspend(std::coroutine_handle<> continuation) noexcept
+    {
+        handle_.promise().continuation_ = continuation;
+        return handle_; // Starts the task right away, without a detour through the caller
+    }
+
+    template <typename T>
+    inline T Task<T>::await_resume()
+    {
+        return handle_.promise().result();
+    }
+
+} // namespace sdbus
+
+#endif /* __cpp_lib_coroutine */
+
+#endif /* SDBUS_CXX_TASK_H_ */
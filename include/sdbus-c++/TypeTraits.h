@@ -56,6 +56,7 @@ namespace sdbus {
     class ObjectPath;
     class Signature;
     class UnixFd;
+    class SharedBuffer;
     template<typename T1, typename T2> using DictEntry = std::pair<T1, T2>;
     class BusName;
     class InterfaceName;
@@ -67,6 +68,7 @@ namespace sdbus {
     class PropertySetCall;
     class PropertyGetReply;
     template <typename... Results> class Result;
+    template <typename T> class Task;
     class Error;
     template <typename T, typename Enable = void> struct signature_of;
 } // namespace sdbus
@@ -80,6 +82,9 @@ namespace sdbus {
     using message_handler = std::function<void(Message msg)>;
     using property_set_callback = std::function<void(PropertySetCall msg)>;
     using property_get_callback = std::function<void(PropertyGetReply& reply)>;
+    using fd_watch_handler = std::function<void(short int revents)>;
+    using timer_handler = std::function<void()>;
+    using outbound_queue_handler = std::function<void(bool congested)>;
 
     // Type-erased RAII-style handle to callbacks/subscriptions registered to sdbus-c++
     using Slot = std::unique_ptr<void, std::function<void(void*)>>;
@@ -103,12 +108,18 @@ namespace sdbus {
     // Tag denoting an asynchronous call that returns std::future as a handle
     struct with_future_t { explicit with_future_t() = default; };
     inline constexpr with_future_t with_future{};
+    // Tag denoting an asynchronous call that returns a C++20 coroutine awaitable as a handle
+    struct with_awaitable_t { explicit with_awaitable_t() = default; };
+    inline constexpr with_awaitable_t with_awaitable{};
     // Tag denoting a call where the reply shouldn't be waited for
     struct dont_expect_reply_t { explicit dont_expect_reply_t() = default; };
     inline constexpr dont_expect_reply_t dont_expect_reply{};
     // Tag denoting that the variant shall embed the other variant as its value, instead of creating a copy
     struct embed_variant_t { explicit embed_variant_t() = default; };
     inline constexpr embed_variant_t embed_variant{};
+    // Tag specifying that the connection shall be used by one thread at a time only, and thus shall not lock the bus
+    struct single_threaded_t { explicit single_threaded_t() = default; };
+    inline constexpr single_threaded_t single_threaded{};
 
     // Helper for static assert
     template <class... T> constexpr bool always_false = false;
@@ -321,6 +332,11 @@ namespace sdbus {
         static constexpr bool is_trivial_dbus_type = false;
     };
 
+    // Travels as a variant holding either the inline byte array or the fd of the sealed memfd
+    template <>
+    struct signature_of<SharedBuffer> : signature_of<Variant>
+    {};
+
     template <typename T1, typename T2>
     struct signature_of<DictEntry<T1, T2>>
     {
@@ -408,6 +424,7 @@ namespace sdbus {
         using function_type = ReturnType (Args...);
 
         static constexpr std::size_t arity = sizeof...(Args);
+        static constexpr bool is_coroutine = false;
 
 //        template <size_t _Idx, typename _Enabled = void>
 //        struct arg;
@@ -473,6 +490,14 @@ namespace sdbus {
         using async_result_t = Result<Results...>;
     };
 
+    template <typename... Args, typename ReturnType>
+    struct function_traits<Task<ReturnType>(Args...)> : function_traits_base<ReturnType, Args...>
+    {
+        static constexpr bool is_async = false;
+        static constexpr bool is_coroutine = true;
+        static constexpr bool has_error_param = false;
+    };
+
     template <typename ReturnType, typename... Args>
     struct function_traits<ReturnType(*)(Args...)> : function_traits<ReturnType(Args...)>
     {};
@@ -508,6 +533,9 @@ namespace sdbus {
     template <class Function>
     constexpr auto is_async_method_v = function_traits<Function>::is_async;
 
+    template <class Function>
+    constexpr auto is_coroutine_method_v = function_traits<Function>::is_coroutine;
+
     template <class Function>
     constexpr auto has_error_param_v = function_traits<Function>::has_error_param;
 
@@ -586,6 +614,32 @@ namespace sdbus {
     template <typename... Args>
     using future_return_t = typename future_return<Args...>::type;
 
+    // Detects types that point into the message they are deserialized from, so they must not outlive it
+    template <typename Type>
+    struct borrows_message_data : std::false_type
+    {};
+
+    template <>
+    struct borrows_message_data<std::string_view> : std::true_type
+    {};
+
+    template <template <typename...> class Template, typename... Types>
+    struct borrows_message_data<Template<Types...>> : std::disjunction<borrows_message_data<std::remove_cv_t<Types>>...>
+    {};
+
+    template <typename Element, std::size_t Size>
+    struct borrows_message_data<std::array<Element, Size>> : borrows_message_data<std::remove_cv_t<Element>>
+    {};
+
+#ifdef __cpp_lib_span
+    template <typename Element, std::size_t Extent>
+    struct borrows_message_data<std::span<const Element, Extent>> : std::true_type
+    {};
+#endif
+
+    template <typename... Types>
+    constexpr bool borrows_message_data_v = (borrows_message_data<std::remove_cv_t<Types>>::value || ...);
+
     // Credit: Piotr Skotnicki (https://stackoverflow.com/a/57639506)
     template <typename, typename>
     constexpr bool is_one_of_variants_types = false;
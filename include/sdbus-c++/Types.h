@@ -32,8 +32,10 @@
 
 #include <cstring>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -55,18 +57,45 @@ namespace sdbus {
     class Variant
     {
     public:
-        Variant();
+        Variant() = default;
+        Variant(const Variant&) = default;
+        Variant& operator=(const Variant&) = default;
+        Variant(Variant&& other) noexcept
+            : type_(std::exchange(other.type_, '\0'))
+            , scalar_(other.scalar_)
+            , string_(std::move(other.string_))
+            , msg_(std::move(other.msg_))
+        {
+        }
+        Variant& operator=(Variant&& other) noexcept
+        {
+            type_ = std::exchange(other.type_, '\0');
+            scalar_ = other.scalar_;
+            string_ = std::move(other.string_);
+            msg_ = std::move(other.msg_);
+            return *this;
+        }
+        ~Variant() = default;
 
         template <typename ValueType>
-        explicit Variant(const ValueType& value) : Variant()
+        explicit Variant(const ValueType& value)
         {
-            msg_.openVariant<ValueType>();
-            msg_ << value;
-            msg_.closeVariant();
-            msg_.seal();
+            if constexpr (inline_type_of<ValueType>() != '\0')
+            {
+                storeInline(value);
+            }
+            else
+            {
+                msg_ = createPlainMessage();
+                msg_.openVariant<ValueType>();
+                msg_ << value;
+                msg_.closeVariant();
+                msg_.seal();
+            }
         }
 
-        Variant(const Variant& value, embed_variant_t) : Variant()
+        Variant(const Variant& value, embed_variant_t)
+            : msg_(createPlainMessage())
         {
             msg_.openVariant<Variant>();
             msg_ << value;
@@ -75,7 +104,8 @@ namespace sdbus {
         }
 
         template <typename Struct>
-        explicit Variant(const as_dictionary<Struct>& value) : Variant()
+        explicit Variant(const as_dictionary<Struct>& value)
+            : msg_(createPlainMessage())
         {
             msg_.openVariant<std::map<std::string, Variant>>();
             msg_ << as_dictionary(value.m_struct);
@@ -85,7 +115,7 @@ namespace sdbus {
 
         template <typename... Elements>
         Variant(const std::variant<Elements...>& value) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions): implicit conversion intentional
-            : Variant()
+            : msg_(createPlainMessage())
         {
             msg_ << value;
             msg_.seal();
@@ -94,6 +124,13 @@ namespace sdbus {
         template <typename ValueType>
         ValueType get() const
         {
+            if constexpr (is_inline_readable_v<ValueType>)
+            {
+                if (type_ == inline_type_of<ValueType>())
+                    return getInline<ValueType>();
+            }
+
+            materialize();
             msg_.rewind(false);
 
             msg_.enterVariant<ValueType>();
@@ -105,6 +142,7 @@ namespace sdbus {
 
         [[nodiscard]] std::string dumpToString() const
         {
+            materialize();
             msg_.rewind(false);
 
             return msg_.dumpToString(Message::DumpFlags::SubtreeOnly);
@@ -122,6 +160,7 @@ namespace sdbus {
         operator std::variant<Elements...>() const // NOLINT(google-explicit-constructor,hicpp-explicit-conversions): implicit conversion intentional
         {
             std::variant<Elements...> result;
+            materialize();
             msg_.rewind(false);
             msg_ >> result;
             return result;
@@ -141,6 +180,73 @@ namespace sdbus {
         const char* peekValueType() const;
 
     private:
+        // D-Bus type of values that are held inline, or '\0' for values held in the message
+        template <typename ValueType>
+        static constexpr char inline_type_of()
+        {
+            using Type = std::remove_cv_t<ValueType>;
+            if constexpr ( std::is_same_v<Type, bool> || std::is_same_v<Type, uint8_t>
+                        || std::is_same_v<Type, int16_t> || std::is_same_v<Type, uint16_t>
+                        || std::is_same_v<Type, int32_t> || std::is_same_v<Type, uint32_t>
+                        || std::is_same_v<Type, int64_t> || std::is_same_v<Type, uint64_t>
+                        || std::is_same_v<Type, double> || std::is_same_v<Type, std::string>
+                        || std::is_same_v<Type, ObjectPath> || std::is_same_v<Type, Signature> )
+                return signature_of<Type>::value[0];
+            else if constexpr ( std::is_same_v<Type, std::string_view> || std::is_same_v<Type, const char*>
+                             || std::is_same_v<Type, char*> || (std::is_array_v<Type> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<Type>>, char>) )
+                return signature_of<std::string>::value[0];
+            else
+                return '\0';
+        }
+
+        template <typename ValueType>
+        static constexpr bool is_inline_readable_v = inline_type_of<ValueType>() != '\0'
+                                                  && std::is_same_v<ValueType, std::decay_t<ValueType>>
+                                                  && !std::is_pointer_v<ValueType>
+                                                  && !std::is_same_v<ValueType, std::string_view>;
+
+        template <typename ValueType>
+        void storeInline(const ValueType& value)
+        {
+            type_ = inline_type_of<ValueType>();
+            if constexpr (std::is_same_v<ValueType, bool>)
+                scalar_.boolean = value ? 1 : 0;
+            else if constexpr (std::is_arithmetic_v<ValueType>)
+                std::memcpy(&scalar_, &value, sizeof(value));
+            else
+                string_ = value;
+        }
+
+        template <typename ValueType>
+        ValueType getInline() const
+        {
+            if constexpr (std::is_same_v<ValueType, bool>)
+                return scalar_.boolean != 0;
+            else if constexpr (std::is_arithmetic_v<ValueType>)
+            {
+                ValueType value{};
+                std::memcpy(&value, &scalar_, sizeof(value));
+                return value;
+            }
+            else
+                return ValueType{string_};
+        }
+
+        // Puts the value into the message, for the operations that work on the message representation only
+        void materialize() const;
+
+        // Scalars and strings (which are short enough for small string optimization mostly) are held inline,
+        // only other values are held in an sd-bus message. The sd-bus representation of each scalar type
+        // starts at the beginning of the union, so it can be passed to sd-bus directly.
+        union Scalar
+        {
+            uint64_t bits;
+            int boolean; // sd-bus representation of D-Bus boolean
+        };
+
+        char type_{};
+        Scalar scalar_{};
+        std::string string_;
         mutable PlainMessage msg_;
     };
 
@@ -404,6 +510,88 @@ namespace sdbus {
         int fd_ = -1;
     };
 
+    /********************************************//**
+     * @class SharedBuffer
+     *
+     * SharedBuffer is an immutable blob of bytes meant for large payloads.
+     *
+     * A payload of at least the inline threshold size is placed in a sealed
+     * memfd, and only its fd travels in the D-Bus message, so the payload is
+     * copied neither through the socket nor through the bus daemon. The receiving
+     * side maps the memfd read-only, so data() then points right into the pages
+     * written by the sender. Smaller payloads are carried inline as a byte array.
+     * On D-Bus, SharedBuffer is a variant holding either `ay` or `h`.
+     *
+     * Copies of a SharedBuffer share the same data.
+     *
+     ***********************************************/
+    class SharedBuffer
+    {
+    public:
+        static constexpr std::size_t DEFAULT_INLINE_THRESHOLD = 64 * 1024;
+        static constexpr std::size_t DEFAULT_MAX_SIZE = std::size_t{1024} * 1024 * 1024;
+
+        SharedBuffer() = default;
+
+        /*!
+         * @brief Creates a buffer holding a copy of the given data
+         */
+        SharedBuffer(const void* data, std::size_t size, std::size_t inlineThreshold = DEFAULT_INLINE_THRESHOLD);
+
+        /*!
+         * @brief Maps the given sealed memfd read-only
+         *
+         * Throws sdbus::Error if the fd is not a memfd sealed against writing and shrinking,
+         * or if it is larger than maxSize. The size of a received memfd is chosen by the peer,
+         * so the limit keeps a peer from making us map an arbitrarily large memfd. Buffers
+         * deserialized from messages are limited to DEFAULT_MAX_SIZE; for another limit,
+         * deserialize the UnixFd and construct the buffer from it.
+         */
+        explicit SharedBuffer(UnixFd fd, std::size_t maxSize = DEFAULT_MAX_SIZE);
+
+        /*!
+         * @brief Creates a buffer of the given size and lets the writer fill it in place
+         *
+         * This spares the copy of the payload on the sending side, too.
+         */
+        static SharedBuffer create( std::size_t size
+                                  , const std::function<void(void* data)>& writer
+                                  , std::size_t inlineThreshold = DEFAULT_INLINE_THRESHOLD );
+
+        [[nodiscard]] const uint8_t* data() const
+        {
+            return data_.get();
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return size_;
+        }
+
+#ifdef __cpp_lib_span
+        [[nodiscard]] std::span<const uint8_t> span() const
+        {
+            return {data(), size()};
+        }
+#endif
+
+        // Whether the data live in a memfd rather than inline
+        [[nodiscard]] bool isShared() const
+        {
+            return fd_.isValid();
+        }
+
+        [[nodiscard]] const UnixFd& getFd() const
+        {
+            return fd_;
+        }
+
+    private:
+        UnixFd fd_;
+        std::shared_ptr<const uint8_t> data_;
+        std::size_t size_{};
+    };
+
     /********************************************//**
      * @typedef DictEntry
      *
@@ -27,6 +27,7 @@
 #define SDBUS_CPP_VTABLEITEMS_INL_
 
 #include <sdbus-c++/Error.h>
+#include <sdbus-c++/Task.h>
 #include <sdbus-c++/TypeTraits.h>
 
 #include <string>
@@ -53,7 +54,14 @@ namespace sdbus {
             // Deserialize input arguments from the message into the tuple.
             call >> inputArgs;
 
-            if constexpr (!is_async_method_v<Function>)
+            if constexpr (is_coroutine_method_v<Function>)
+            {
+#ifdef __cpp_lib_coroutine
+                // Start the coroutine, which sends the reply when done. Until then, it doesn't occupy this thread.
+                detail::invoke_coroutine_method<function_result_t<Function>>(std::move(call), callback, std::move(inputArgs));
+#endif // __cpp_lib_coroutine
+            }
+            else if constexpr (!is_async_method_v<Function>)
             {
                 // Invoke callback with input arguments from the tuple.
                 auto ret = sdbus::apply(callback, inputArgs);
@@ -26,13 +26,17 @@
 
 // IWYU pragma: begin_exports
 #include <sdbus-c++/IConnection.h>
+#include <sdbus-c++/ConnectionPool.h>
 #include <sdbus-c++/IObject.h>
 #include <sdbus-c++/IProxy.h>
 #include <sdbus-c++/AdaptorInterfaces.h>
 #include <sdbus-c++/ProxyInterfaces.h>
 #include <sdbus-c++/StandardInterfaces.h>
 #include <sdbus-c++/Message.h>
+#include <sdbus-c++/Executor.h>
 #include <sdbus-c++/MethodResult.h>
+#include <sdbus-c++/Awaitable.h>
+#include <sdbus-c++/Task.h>
 #include <sdbus-c++/Types.h>
 #include <sdbus-c++/TypeTraits.h>
 #include <sdbus-c++/Error.h>
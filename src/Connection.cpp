@@ -32,20 +32,27 @@
 #include "sdbus-c++/Types.h"
 #include "sdbus-c++/TypeTraits.h"
 
+#include "Epoll.h"
 #include "ISdBus.h"
 #include "MessageUtils.h"
 #include "ScopeGuard.h"
 #include "SdBus.h"
+#include "ThreadPool.h"
+#include "Tracepoints.h"
 #include "Utils.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cerrno>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <ctime>
 #include <memory>
 #include <poll.h>
+#include <span>
 #include <string>
 #include <sys/eventfd.h>
 #include SDBUS_HEADER
@@ -58,11 +65,77 @@
 
 namespace sdbus::internal {
 
+namespace {
+
+// Message being processed by a handler dispatched to a worker thread, see Connection::dispatchToWorkerThread()
+struct DispatchedMessage
+{
+    const Connection* connection{};
+    sd_bus_message* message{};
+};
+thread_local DispatchedMessage currentlyDispatchedMessage{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// Connection whose internal event loop runs in this thread, if any
+thread_local const Connection* currentEventLoop{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// When sd-bus has started dispatching the message it is processing in this thread, see Connection::processBus()
+struct DispatchStart
+{
+    const Connection* connection{};
+    std::chrono::steady_clock::time_point time{};
+};
+thread_local DispatchStart currentDispatchStart{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// Messages held back by a cork of a connection in this thread, see Connection::cork()
+struct CorkedMessages
+{
+    const Connection* connection{};
+    std::vector<sd_bus_message*> messages; // Referenced until sent
+};
+thread_local std::vector<CorkedMessages*> currentCorks{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+CorkedMessages* findCork(const Connection* connection)
+{
+    auto it = std::find_if(currentCorks.begin(), currentCorks.end(), [connection](const auto* cork){ return cork->connection == connection; });
+    return it != currentCorks.end() ? *it : nullptr;
+}
+
+// Tags identifying fds the internal event loop waits on, in epoll registrations as well as in io_uring requests
+enum EventLoopTag : uint64_t
+{   BUS_FD_TAG
+,   BUS_TIMER_TAG
+,   EVENT_FD_TAG
+,   LOOP_EXIT_FD_TAG
+,   USER_EVENT_SOURCES_TAG
+,   IGNORED_TAG // Completions of io_uring requests we are not interested in
+};
+
+// io_uring user data of a bus fd poll carries, next to the tag, a generation number of the poll
+constexpr unsigned int BUS_FD_GENERATION_SHIFT = 8;
+constexpr uint64_t EVENT_LOOP_TAG_MASK = (1U << BUS_FD_GENERATION_SHIFT) - 1;
+
+constexpr unsigned int IO_URING_ENTRIES = 64;
+
+} // namespace
+
 Connection::Connection(std::unique_ptr<ISdBus>&& interface, const BusFactory& busFactory)
     : sdbus_(std::move(interface))
+    , singleThreaded_(dynamic_cast<SingleThreadedSdBus*>(sdbus_.get()) != nullptr)
     , bus_(openBus(busFactory))
 {
     assert(sdbus_ != nullptr);
+
+    // The bus fd itself is registered lazily, with its current events, by the event loop
+    epoll_.add(busTimerFd_.fd, EPOLLIN, BUS_TIMER_TAG);
+    epoll_.add(eventFd_.fd, EPOLLIN, EVENT_FD_TAG);
+    epoll_.add(loopExitFd_.fd, EPOLLIN, LOOP_EXIT_FD_TAG);
+    epoll_.add(userEventSourcesEpoll_.fd, EPOLLIN, USER_EVENT_SOURCES_TAG);
+
+    // Count and time all messages sd-bus dispatches, see getStatistics()
+    sd_bus_slot *slot{};
+    auto r = sdbus_->sd_bus_add_filter(bus_.get(), &slot, &Connection::sdbus_dispatch_filter, this);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to add statistics filter", -r);
+    dispatchFilter_ = {slot, [this](void *slot){ sdbus_->sd_bus_slot_unref(static_cast<sd_bus_slot*>(slot)); }};
 }
 
 Connection::Connection(std::unique_ptr<ISdBus>&& interface, default_bus_t)
@@ -110,9 +183,16 @@ Connection::Connection(std::unique_ptr<ISdBus>&& interface, sdbus_bus_t, sd_bus
 {
 }
 
+// A pseudo connection only serves as a factory of local messages, so it never runs an event loop. It opens no fds
+// and installs no filter, it's just an sd_bus object that is never started, plus the Connection object itself.
 Connection::Connection(std::unique_ptr<ISdBus>&& interface, pseudo_bus_t)
     : sdbus_(std::move(interface))
     , bus_(openPseudoBus())
+    , loopExitFd_(no_fd)
+    , eventFd_(no_fd)
+    , epoll_(no_fd)
+    , busTimerFd_(no_fd)
+    , userEventSourcesEpoll_(no_fd)
 {
     assert(sdbus_ != nullptr);
 }
@@ -164,14 +244,21 @@ BusName Connection::getUniqueName() const
 
 void Connection::enterEventLoop()
 {
+    registerEventLoopThread();
+    SCOPE_EXIT{ unregisterEventLoopThread(); };
+
     while (true)
     {
-        // Process one pending event
-        (void)processPendingEvent();
+        // Process a batch of pending events, as far as the dispatch budget allows
+        auto processed = processPendingEvents();
+
+        // In busy-poll mode, look for further messages for a while without going to sleep
+        auto busyPolled = processed && busyPollForNextEvent();
 
-        // And go to poll(), which wakes us up right away
-        // if there's another pending event, or sleeps otherwise.
-        auto success = waitForNextEvent();
+        // And go to epoll_wait(), which wakes us up right away if there's another pending event,
+        // or sleeps otherwise. Having found a message while busy polling, we just check the other
+        // fds (exit and wake-up requests, user fd watches and timers) without sleeping.
+        auto success = waitForNextEvent(/*sleep*/ !busyPolled);
         if (!success)
             break; // Exit I/O event loop
     }
@@ -238,16 +325,257 @@ uint64_t Connection::getMethodCallTimeout() const
     return timeout;
 }
 
+void Connection::setNonBlockingMethodCalls(bool enabled)
+{
+    // The caller thread would wait for the reply while the event loop thread works with the bus
+    SDBUS_THROW_ERROR_IF(enabled && singleThreaded_, "Non-blocking method calls are not supported on single-threaded connections", ENOTSUP);
+
+    nonBlockingMethodCalls_ = enabled;
+}
+
+bool Connection::areMethodCallsNonBlocking() const
+{
+    return nonBlockingMethodCalls_;
+}
+
+void Connection::setDispatchThreadCount(std::size_t threadCount)
+{
+    // Worker threads would send replies concurrently with the event loop thread
+    SDBUS_THROW_ERROR_IF(threadCount > 0 && singleThreaded_, "Worker threads are not supported on single-threaded connections", ENOTSUP);
+
+    // Destroying the current thread pool finishes all messages already dispatched to it
+    dispatchThreadPool_.reset();
+
+    if (threadCount > 0)
+        dispatchThreadPool_ = std::make_unique<ThreadPool>(threadCount);
+}
+
+std::size_t Connection::getDispatchThreadCount() const
+{
+    return dispatchThreadPool_ ? dispatchThreadPool_->size() : 0;
+}
+
+Slot Connection::addFdWatch(int fd, short int events, fd_watch_handler callback, return_slot_t)
+{
+    SDBUS_THROW_ERROR_IF(fd < 0, "Invalid file descriptor provided", EINVAL);
+    SDBUS_THROW_ERROR_IF(!callback, "Invalid fd watch callback handler provided", EINVAL);
+
+    auto source = std::make_shared<UserEventSource>();
+    source->fd = fd;
+    source->fdCallback = std::move(callback);
+
+    return addUserEventSource(std::move(source), Epoll::toEpollEvents(events));
+}
+
+Slot Connection::addTimer(std::chrono::microseconds interval, timer_handler callback, return_slot_t)
+{
+    SDBUS_THROW_ERROR_IF(!callback, "Invalid timer callback handler provided", EINVAL);
+
+    auto source = std::make_shared<UserEventSource>();
+    source->timer = std::make_unique<TimerFd>();
+    source->timer->armPeriodic(interval);
+    source->fd = source->timer->fd;
+    source->timerCallback = std::move(callback);
+
+    return addUserEventSource(std::move(source), EPOLLIN);
+}
+
+void Connection::setEventLoopBackend(EventLoopBackend backend)
+{
+    ioUring_.reset();
+    ioUringPolls_ = {};
+
+    if (backend != EventLoopBackend::IoUring)
+        return;
+
+    try
+    {
+        ioUring_ = std::make_unique<IoUring>(IO_URING_ENTRIES);
+    }
+    catch (const Error&)
+    {
+        // io_uring not built in, or not supported/allowed by the kernel, so we stay with epoll
+    }
+}
+
+Connection::EventLoopBackend Connection::getEventLoopBackend() const
+{
+    return ioUring_ != nullptr ? EventLoopBackend::IoUring : EventLoopBackend::Epoll;
+}
+
+void Connection::setDispatchBudget(const DispatchBudget& budget)
+{
+    SDBUS_THROW_ERROR_IF(budget.maxMessages == 0, "Invalid dispatch budget message count provided", EINVAL);
+    SDBUS_THROW_ERROR_IF(budget.maxDuration.count() < 0, "Invalid dispatch budget duration provided", EINVAL);
+
+    dispatchBudgetMessages_ = budget.maxMessages;
+    dispatchBudgetDuration_ = budget.maxDuration;
+}
+
+Connection::DispatchBudget Connection::getDispatchBudget() const
+{
+    return {dispatchBudgetMessages_.load(), dispatchBudgetDuration_.load()};
+}
+
+void Connection::setBusyPollWindow(std::chrono::microseconds window)
+{
+    SDBUS_THROW_ERROR_IF(window.count() < 0, "Invalid busy-poll window provided", EINVAL);
+
+    busyPollWindow_ = window;
+}
+
+std::chrono::microseconds Connection::getBusyPollWindow() const
+{
+    return busyPollWindow_.load();
+}
+
+void Connection::setOutboundQueueWatermarks(const OutboundQueueWatermarks& watermarks)
+{
+    SDBUS_THROW_ERROR_IF( watermarks.high != 0 && watermarks.low >= watermarks.high
+                        , "Invalid outbound queue watermarks provided"
+                        , EINVAL );
+
+    outboundQueueHighWatermark_ = watermarks.high;
+    outboundQueueLowWatermark_ = watermarks.low;
+
+    // The new watermarks may make the queue congested or drained right away
+    updateOutboundQueueState();
+}
+
+Connection::OutboundQueueWatermarks Connection::getOutboundQueueWatermarks() const
+{
+    return {outboundQueueHighWatermark_.load(), outboundQueueLowWatermark_.load()};
+}
+
+void Connection::setOutboundQueueHandler(outbound_queue_handler handler)
+{
+    const std::lock_guard lock(outboundQueueHandlerMutex_);
+    outboundQueueHandler_ = std::move(handler);
+}
+
+void Connection::sendBatch(const Message* messages, std::size_t count)
+{
+    std::vector<sd_bus_message*> sdbusMsgs;
+    sdbusMsgs.reserve(count);
+    for (const auto& message : std::span{messages, count})
+        sdbusMsgs.push_back(static_cast<sd_bus_message*>(Message::Factory::getHandle(message)));
+
+    if (auto* cork = findCork(this); cork != nullptr)
+    {
+        for (auto* sdbusMsg : sdbusMsgs)
+            cork->messages.push_back(sdbus_->sd_bus_message_ref(sdbusMsg));
+        return;
+    }
+
+    sendMessages(sdbusMsgs);
+}
+
+Slot Connection::cork()
+{
+    if (findCork(this) != nullptr)
+        return {}; // The outer cork sends the messages, keeping their order
+
+    auto cork = std::make_unique<CorkedMessages>();
+    cork->connection = this;
+    currentCorks.push_back(cork.get());
+
+    return {cork.release(), [this](void* ptr)
+    {
+        std::unique_ptr<CorkedMessages> cork{static_cast<CorkedMessages*>(ptr)};
+        auto it = std::find(currentCorks.begin(), currentCorks.end(), cork.get());
+        assert(it != currentCorks.end()); // The cork must be destroyed in the thread that has created it
+        if (it != currentCorks.end())
+            currentCorks.erase(it);
+
+        SCOPE_EXIT
+        {
+            for (auto* sdbusMsg : cork->messages)
+                sdbus_->sd_bus_message_unref(sdbusMsg);
+        };
+
+        try
+        {
+            sendMessages(cork->messages);
+        }
+        catch (const Error&)
+        {
+            // There is nobody to report the failure to from a destructor
+        }
+    }};
+}
+
+Connection::Statistics Connection::getStatistics() const
+{
+    return statistics_.snapshot();
+}
+
+void Connection::setDispatchWatchdog(std::chrono::microseconds threshold, dispatch_stall_handler handler)
+{
+    SDBUS_THROW_ERROR_IF(threshold.count() < 0, "Invalid dispatch watchdog threshold provided", EINVAL);
+
+    const std::lock_guard lock(watchdogMutex_);
+    if (watchdogOwner_ == nullptr)
+    {
+        if (threshold == std::chrono::microseconds::zero())
+            return; // No watchdog to turn off
+        watchdogOwner_ = std::make_unique<DispatchWatchdog>();
+    }
+
+    watchdogOwner_->configure(threshold, std::move(handler));
+    watchdog_.store(watchdogOwner_.get(), std::memory_order_release);
+}
+
+std::map<std::string, uint64_t> Connection::getDispatchStallCounts() const
+{
+    auto* watchdog = watchdog_.load(std::memory_order_acquire);
+    return watchdog != nullptr ? watchdog->getStallCounts() : std::map<std::string, uint64_t>{};
+}
+
+std::size_t Connection::getOutboundQueueLength() const
+{
+    uint64_t readQueueSize{};
+    uint64_t writeQueueSize{};
+
+    auto r = sdbus_->sd_bus_get_n_queued(bus_.get(), &readQueueSize, &writeQueueSize);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get number of pending messages in sd-bus write queue", -r);
+    statistics_.recordQueueLengths(readQueueSize, writeQueueSize);
+
+    return writeQueueSize;
+}
+
+void Connection::setCallbackExecutor(Executor executor)
+{
+    std::lock_guard lock(callbackExecutorMutex_);
+    callbackExecutor_ = std::move(executor);
+}
+
+Executor Connection::getCallbackExecutor() const
+{
+    std::lock_guard lock(callbackExecutorMutex_);
+    return callbackExecutor_;
+}
+
 void Connection::addMatch(const std::string& match, message_handler callback)
 {
     floatingMatchRules_.push_back(addMatch(match, std::move(callback), return_slot));
 }
 
 Slot Connection::addMatch(const std::string& match, message_handler callback, return_slot_t)
+{
+    return addMatch(match, std::move(callback), Executor{}, return_slot);
+}
+
+void Connection::addMatch(const std::string& match, message_handler callback, Executor executor)
+{
+    floatingMatchRules_.push_back(addMatch(match, std::move(callback), executor, return_slot));
+}
+
+Slot Connection::addMatch(const std::string& match, message_handler callback, Executor executor, return_slot_t)
 {
     SDBUS_THROW_ERROR_IF(!callback, "Invalid match callback handler provided", EINVAL);
 
-    auto matchInfo = std::make_unique<MatchInfo>(MatchInfo{std::move(callback), {}, *this, {}});
+    auto matchInfo = std::make_unique<MatchInfo>(MatchInfo{std::move(callback), {}, *this, {}, {}});
+    matchInfo->executor = ExecutorBinding{executor ? executor : getCallbackExecutor(), matchInfo.get(), &Connection::invokePostedMatchCallback};
 
     sd_bus_slot *slot{};
     auto r = sdbus_->sd_bus_add_match(bus_.get(), &slot, match.c_str(), &Connection::sdbus_match_callback, matchInfo.get());
@@ -271,7 +599,8 @@ Slot Connection::addMatchAsync( const std::string& match
     SDBUS_THROW_ERROR_IF(!callback, "Invalid match callback handler provided", EINVAL);
 
     sd_bus_message_handler_t sdbusInstallCallback = installCallback ? &Connection::sdbus_match_install_callback : nullptr;
-    auto matchInfo = std::make_unique<MatchInfo>(MatchInfo{std::move(callback), std::move(installCallback), *this, {}});
+    auto matchInfo = std::make_unique<MatchInfo>(MatchInfo{std::move(callback), std::move(installCallback), *this, {}, {}});
+    matchInfo->executor = ExecutorBinding{getCallbackExecutor(), matchInfo.get(), &Connection::invokePostedMatchCallback};
 
     sd_bus_slot *slot{};
     auto r = sdbus_->sd_bus_add_match_async( bus_.get()
@@ -529,6 +858,7 @@ MethodCall Connection::createMethodCall( const char* destination
                                                    , methodName);
 
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to create method call", -r);
+    SDBUS_TRACEPOINT(message_created, SD_BUS_MESSAGE_METHOD_CALL, methodName);
 
     // TODO: const_cast..? Finish the const correctness design
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
@@ -551,6 +881,7 @@ Signal Connection::createSignal( const char* objectPath
     auto r = sdbus_->sd_bus_message_new_signal(bus_.get(), &sdbusMsg, objectPath, interfaceName, signalName);
 
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to create signal", -r);
+    SDBUS_TRACEPOINT(message_created, SD_BUS_MESSAGE_SIGNAL, signalName);
 
     // TODO: const_cast..? Finish the const correctness design
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
@@ -667,6 +998,18 @@ sd_bus_creds* Connection::decrementCredsRefCount(sd_bus_creds* creds)
 
 sd_bus_message* Connection::callMethod(sd_bus_message* sdbusMsg, uint64_t timeout)
 {
+    // In non-blocking mode, we let the event loop thread deliver the reply to us,
+    // so the bus connection is not locked for the whole round trip of the call.
+    if (nonBlockingMethodCalls_)
+    {
+        PendingSyncCall call{.connection = *this};
+        if (registerPendingSyncCall(call))
+        {
+            SCOPE_EXIT{ unregisterPendingSyncCall(call); };
+            return callMethodNonBlocking(sdbusMsg, timeout, call);
+        }
+    }
+
     sd_bus_error sdbusError = SD_BUS_ERROR_NULL;
     SCOPE_EXIT{ sd_bus_error_free(&sdbusError); };
 
@@ -679,6 +1022,7 @@ sd_bus_message* Connection::callMethod(sd_bus_message* sdbusMsg, uint64_t timeou
         throw Error(Error::Name{sdbusError.name}, sdbusError.message);
 
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to call method", -r);
+    countSentMessage(sdbusMsg);
 
     // Wake up event loop to process messages that may have arrived in the meantime,
     // or to dispatch the outbound message that hasn't yet been fully sent out.
@@ -687,6 +1031,27 @@ sd_bus_message* Connection::callMethod(sd_bus_message* sdbusMsg, uint64_t timeou
     return sdbusReply;
 }
 
+sd_bus_message* Connection::callMethodNonBlocking(sd_bus_message* sdbusMsg, uint64_t timeout, PendingSyncCall& call)
+{
+    // The slot must be released before the call data, so that the reply handler can't be invoked on dangling data
+    auto slot = callMethodAsync(sdbusMsg, &Connection::sdbus_sync_call_reply_handler, &call, timeout, return_slot);
+
+    std::unique_lock lock(call.mutex);
+    call.cond.wait(lock, [&call](){ return call.reply != nullptr || call.abandoned; });
+    SDBUS_THROW_ERROR_IF(call.reply == nullptr, "Event loop left while waiting for method reply", ECANCELED);
+    auto* sdbusReply = std::exchange(call.reply, nullptr);
+    lock.unlock();
+
+    if (const auto* error = sd_bus_message_get_error(sdbusReply); error != nullptr)
+    {
+        Error exception(Error::Name{error->name}, error->message);
+        decrementMessageRefCount(sdbusReply);
+        throw exception;
+    }
+
+    return sdbusReply;
+}
+
 Slot Connection::callMethodAsync(sd_bus_message* sdbusMsg, sd_bus_message_handler_t callback, void* userData, uint64_t timeout, return_slot_t)
 {
     sd_bus_slot *slot{};
@@ -695,6 +1060,8 @@ Slot Connection::callMethodAsync(sd_bus_message* sdbusMsg, sd_bus_message_handle
     auto timeoutBefore = getEventLoopPollData().timeout;
     auto r = sdbus_->sd_bus_call_async(nullptr, &slot, sdbusMsg, callback, userData, timeout);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to call method asynchronously", -r);
+    countSentMessage(sdbusMsg);
+    SDBUS_TRACEPOINT(method_call_sent, traceCookie(sdbusMsg), sd_bus_message_get_member(sdbusMsg), timeout);
     auto timeoutAfter = getEventLoopPollData().timeout;
 
     // An event loop may wait in poll with timeout `t1', while in another thread an async call is made with
@@ -708,12 +1075,84 @@ Slot Connection::callMethodAsync(sd_bus_message* sdbusMsg, sd_bus_message_handle
 
 void Connection::sendMessage(sd_bus_message* sdbusMsg)
 {
+    if (auto* cork = findCork(this); cork != nullptr)
+    {
+        cork->messages.push_back(sdbus_->sd_bus_message_ref(sdbusMsg));
+        return;
+    }
+
     auto r = sdbus_->sd_bus_send(nullptr, sdbusMsg, nullptr);
 
     // Wake up event loop to continue dispatching the (fairly large) outbound message that hasn't yet been fully sent
     wakeUpEventLoopIfMessagesInQueue();
 
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to send D-Bus message", -r);
+    countSentMessage(sdbusMsg);
+    SDBUS_TRACEPOINT(message_sent, traceCookie(sdbusMsg), traceType(sdbusMsg), sd_bus_message_get_member(sdbusMsg));
+
+    // Let the producers know if the message has made the outbound queue congested
+    updateOutboundQueueState();
+}
+
+void Connection::sendMessages(std::span<sd_bus_message* const> sdbusMsgs)
+{
+    if (sdbusMsgs.empty())
+        return;
+
+    auto r = sdbus_->sd_bus_send_batch(nullptr, sdbusMsgs.data(), sdbusMsgs.size());
+
+    // One wake-up for the whole batch, see sendMessage()
+    wakeUpEventLoopIfMessagesInQueue();
+
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to send D-Bus messages", -r);
+    for (auto* sdbusMsg : sdbusMsgs)
+    {
+        countSentMessage(sdbusMsg);
+        SDBUS_TRACEPOINT(message_sent, traceCookie(sdbusMsg), traceType(sdbusMsg), sd_bus_message_get_member(sdbusMsg));
+    }
+
+    updateOutboundQueueState();
+}
+
+void Connection::countSentMessage(sd_bus_message* sdbusMsg) noexcept
+{
+    uint8_t type{};
+    (void)sd_bus_message_get_type(sdbusMsg, &type);
+    statistics_.recordSent(type);
+}
+
+bool Connection::trySendMessage(sd_bus_message* sdbusMsg)
+{
+    // The check and the send are not atomic, so concurrent producers may overshoot the high watermark slightly
+    auto highWatermark = outboundQueueHighWatermark_.load(std::memory_order_relaxed);
+    if (highWatermark != 0 && getOutboundQueueLength() >= highWatermark)
+        return false;
+
+    sendMessage(sdbusMsg);
+    return true;
+}
+
+bool Connection::dispatchToWorkerThread(sd_bus_message* sdbusMsg, TaskGroup& tasks, Strand* strand, std::function<void()> handler)
+{
+    if (dispatchThreadPool_ == nullptr)
+        return false;
+
+    // The handler keeps the message alive, so it's safe to refer to it by a plain pointer here
+    auto task = tasks.track([this, sdbusMsg, handler = std::move(handler)]()
+    {
+        // Make the message available to the handler through getCurrentlyProcessedMessage()
+        auto previous = std::exchange(currentlyDispatchedMessage, {this, sdbusMsg});
+        SCOPE_EXIT{ currentlyDispatchedMessage = previous; };
+
+        handler();
+    });
+
+    if (strand != nullptr)
+        strand->post(*dispatchThreadPool_, std::move(task));
+    else
+        dispatchThreadPool_->post(std::move(task));
+
+    return true;
 }
 
 sd_bus_message* Connection::createMethodReply(sd_bus_message* sdbusMsg)
@@ -782,11 +1221,15 @@ void Connection::finishHandshake(sd_bus* bus)
 
 void Connection::notifyEventLoopToExit()
 {
+    eventLoopInterrupted_.store(true, std::memory_order_relaxed);
     loopExitFd_.notify();
 }
 
 void Connection::notifyEventLoopToWakeUpFromPoll()
 {
+    // The event loop itself re-reads poll data after the current batch anyway, so only other threads interrupt it
+    if (currentEventLoop != this)
+        eventLoopInterrupted_.store(true, std::memory_order_relaxed);
     eventFd_.notify();
 }
 
@@ -810,62 +1253,400 @@ void Connection::joinWithEventLoop()
         asyncLoopThread_.join();
 }
 
+void Connection::registerEventLoopThread()
+{
+    currentEventLoop = this;
+
+    const std::lock_guard lock(syncCallsMutex_);
+    eventLoopThreadId_ = std::this_thread::get_id();
+}
+
+void Connection::unregisterEventLoopThread()
+{
+    currentEventLoop = nullptr;
+
+    const std::lock_guard lock(syncCallsMutex_);
+    eventLoopThreadId_ = {};
+
+    // Nobody will deliver replies to the pending non-blocking calls anymore
+    for (auto* call : pendingSyncCalls_)
+    {
+        const std::lock_guard callLock(call->mutex);
+        call->abandoned = true;
+        call->cond.notify_one();
+    }
+}
+
+bool Connection::registerPendingSyncCall(PendingSyncCall& call)
+{
+    const std::lock_guard lock(syncCallsMutex_);
+
+    // Waiting for the reply only makes sense if there is an event loop in another thread to deliver it
+    if (eventLoopThreadId_ == std::thread::id{} || eventLoopThreadId_ == std::this_thread::get_id())
+        return false;
+
+    pendingSyncCalls_.push_back(&call);
+    return true;
+}
+
+void Connection::unregisterPendingSyncCall(PendingSyncCall& call)
+{
+    const std::lock_guard lock(syncCallsMutex_);
+    pendingSyncCalls_.erase(std::find(pendingSyncCalls_.begin(), pendingSyncCalls_.end(), &call));
+}
+
 bool Connection::processPendingEvent()
 {
-    auto *bus = bus_.get();
-    assert(bus != nullptr);
+    return processPendingEvent(std::chrono::steady_clock::now());
+}
+
+bool Connection::processPendingEvent(std::chrono::steady_clock::time_point pickupTime)
+{
+    assert(bus_ != nullptr);
 
-    const int r = sdbus_->sd_bus_process(bus, nullptr);
+    const int r = processBus(pickupTime);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to process bus requests", -r);
 
     // In correct use of sdbus-c++ API, r can be 0 only when processPendingEvent()
     // is called from an external event loop as a reaction to event fd being signalled.
     // If there are no more D-Bus messages to process, we know we have to clear event fd.
-    if (r == 0)
-        eventFd_.clear();
+    if (r == 0 && eventFd_.clear())
+        statistics_.recordSpuriousWakeup();
+
+    // Processing has possibly written out queued messages, so a congested outbound queue may have drained
+    if (outboundQueueCongested_.load(std::memory_order_relaxed))
+        updateOutboundQueueState();
 
     return r > 0;
 }
 
-bool Connection::waitForNextEvent() // NOLINT(misc-no-recursion)
+bool Connection::processPendingEvents()
+{
+    auto maxMessages = dispatchBudgetMessages_.load(std::memory_order_relaxed);
+    auto maxDuration = dispatchBudgetDuration_.load(std::memory_order_relaxed);
+    auto pickupTime = std::chrono::steady_clock::now(); // Messages of the batch count as picked up now, see getStatistics()
+    auto deadline = pickupTime + maxDuration;
+
+    // The flag is only a shortcut. Whoever sets it also signals an fd, which the next poll picks up in any case.
+    eventLoopInterrupted_.store(false, std::memory_order_relaxed);
+
+    std::size_t i = 0;
+    for (; i < maxMessages; ++i)
+    {
+        if (!processPendingEvent(pickupTime))
+            break; // Nothing more to process, the queues are drained
+        if (eventLoopInterrupted_.load(std::memory_order_relaxed))
+            break; // Let the poll see the exit or wake-up request right away
+        if (std::chrono::steady_clock::now() >= deadline)
+            break; // Give the other fds (exit and wake-up requests, user fd watches and timers) a chance
+    }
+
+    return i > 0;
+}
+
+bool Connection::busyPollForNextEvent()
+{
+    auto window = busyPollWindow_.load(std::memory_order_relaxed);
+    if (window == std::chrono::microseconds::zero())
+        return false;
+
+    auto now = std::chrono::steady_clock::now();
+    auto deadline = now + window;
+
+    do
+    {
+        if (eventLoopInterrupted_.load(std::memory_order_relaxed))
+            return false; // Let the poll see the exit or wake-up request right away
+
+        // sd_bus_process() reads from the bus socket without blocking. Unlike processPendingEvent(), we don't
+        // clear the event fd when there's nothing to process, to spare a system call per iteration.
+        const int r = processBus(now);
+        SDBUS_THROW_ERROR_IF(r < 0, "Failed to process bus requests", -r);
+        if (r > 0)
+            return true;
+
+        // Let the peer, or the bus broker, run if it shares the CPU core with us. That's only a cheap
+        // system call otherwise, compared to the syscall of sd_bus_process() reading the socket anyway.
+        std::this_thread::yield();
+        now = std::chrono::steady_clock::now();
+    } while (now < deadline);
+
+    return false;
+}
+
+int Connection::processBus(std::chrono::steady_clock::time_point pickupTime)
+{
+    // The statistics filter, or the handler of a reply to a pending call, records when sd-bus starts dispatching
+    // a message, if it dispatches any in this call
+    auto previous = std::exchange(currentDispatchStart, {this, {}});
+    SCOPE_EXIT{ currentDispatchStart = previous; };
+
+    const int r = sdbus_->sd_bus_process(bus_.get(), nullptr);
+
+    if (auto start = currentDispatchStart.time; start != std::chrono::steady_clock::time_point{})
+    {
+        statistics_.recordDispatch(start - pickupTime, std::chrono::steady_clock::now() - start);
+        if (auto* watchdog = watchdog_.load(std::memory_order_acquire); watchdog != nullptr)
+            watchdog->dispatchFinished();
+    }
+
+    return r;
+}
+
+bool Connection::waitForNextEvent(bool sleep)
 {
     assert(bus_ != nullptr);
-    assert(loopExitFd_.fd >= 0);
-    assert(eventFd_.fd >= 0);
 
-    auto sdbusPollData = getEventLoopPollData();
-    struct pollfd fds[] = { {sdbusPollData.fd, sdbusPollData.events, 0}
-                          , {eventFd_.fd, POLLIN, 0}
-                          , {loopExitFd_.fd, POLLIN, 0} };
-    constexpr auto fdsCount = sizeof(fds)/sizeof(fds[0]);
+    return ioUring_ != nullptr ? waitForNextEventWithIoUring(sleep) : waitForNextEventWithEpoll(sleep);
+}
 
-    // Are there pending messages in the inbound queue? Then sd-bus will set timeout to 0, so poll() will wake up right away.
-    // Are there pending messages in the outbound queue? Then sd-bus will add POLLOUT to events, so poll() will wake up right away.
-    auto timeout = sdbusPollData.getPollTimeout();
-    auto r = poll(fds, fdsCount, timeout);
+bool Connection::waitForNextEventWithEpoll(bool sleep)
+{
+    constexpr int maxEvents = 16;
+    std::array<epoll_event, maxEvents> events{};
 
-    if (r < 0 && errno == EINTR)
-        return true; // Try again
+    while (true)
+    {
+        auto sdbusPollData = getEventLoopPollData();
+        auto timeout = updateEpollRegistrations(sdbusPollData);
+        if (!sleep)
+            timeout = 0;
+
+        auto count = epoll_.wait(events.data(), maxEvents, timeout);
+        if (sleep)
+            statistics_.recordPollWakeup();
+        if (count == 0)
+            return true; // Pending messages in the inbound queue, or interrupted by a signal
+
+        bool busEvent{};
+        bool wakeUpEvent{};
+        for (const auto& event : std::span{events.data(), static_cast<std::size_t>(count)})
+        {
+            switch (event.data.u64)
+            {
+                case BUS_FD_TAG:
+                    busEvent = true;
+                    break;
+                case BUS_TIMER_TAG:
+                    (void)busTimerFd_.clear();
+                    busTimerExpiry_ = std::chrono::microseconds::max(); // Expired, so it must be re-armed even for the same time
+                    busEvent = true;
+                    break;
+                case EVENT_FD_TAG:
+                {
+                    // Wake up notification, in order that we re-enter epoll with freshly read PollData
+                    auto cleared = eventFd_.clear();
+                    SDBUS_THROW_ERROR_IF(!cleared, "Failed to read from the event descriptor", -errno);
+                    wakeUpEvent = true;
+                    break;
+                }
+                case LOOP_EXIT_FD_TAG:
+                {
+                    auto cleared = loopExitFd_.clear();
+                    SDBUS_THROW_ERROR_IF(!cleared, "Failed to read from the loop exit descriptor", -errno);
+                    return false;
+                }
+                case USER_EVENT_SOURCES_TAG:
+                    invokeUserEventSources();
+                    break;
+                default:
+                    assert(false);
+                    break;
+            }
+        }
+
+        if (busEvent)
+            return true;
+        if (wakeUpEvent)
+            statistics_.recordSpuriousWakeup();
+        // Otherwise go wait again, with freshly calculated, up-to-date timeout and with up-to-date events to watch
+    }
+}
 
-    SDBUS_THROW_ERROR_IF(r < 0, "Failed to wait on the bus", -errno);
+int Connection::updateEpollRegistrations(const PollData& pollData)
+{
+    // Are there pending messages in the outbound queue? Then sd-bus will add POLLOUT to events, so we will wake up right away.
+    auto busEvents = Epoll::toEpollEvents(pollData.events);
+    if (pollData.fd != epollBusFd_)
+    {
+        if (epollBusFd_ >= 0)
+            epoll_.remove(epollBusFd_);
+        epoll_.add(pollData.fd, busEvents, BUS_FD_TAG);
+        epollBusFd_ = pollData.fd;
+        epollBusEvents_ = busEvents;
+    }
+    else if (busEvents != epollBusEvents_)
+    {
+        epoll_.modify(pollData.fd, busEvents, BUS_FD_TAG);
+        epollBusEvents_ = busEvents;
+    }
 
-    // Wake up notification, in order that we re-enter poll with freshly read PollData (namely, new poll timeout thereof)
-    if (fds[1].revents & POLLIN) // NOLINT(readability-implicit-bool-conversion)
+    // Are there pending messages in the inbound queue? Then sd-bus will set timeout to 0, so we won't sleep at all.
+    if (pollData.timeout == std::chrono::microseconds::zero())
+        return 0;
+
+    // The timer fd is only re-armed when the sd-bus timeout changes, e.g. upon a new method call
+    if (pollData.timeout != busTimerExpiry_)
     {
-        auto cleared = eventFd_.clear();
-        SDBUS_THROW_ERROR_IF(!cleared, "Failed to read from the event descriptor", -errno);
-        // Go poll() again, but with freshly calculated, up-to-date timeout and with up-to-date events to watch
-        return waitForNextEvent();
+        if (pollData.timeout == std::chrono::microseconds::max())
+            busTimerFd_.disarm();
+        else
+            busTimerFd_.armAt(pollData.timeout);
+        busTimerExpiry_ = pollData.timeout;
     }
-    // Loop exit notification
-    if (fds[2].revents & POLLIN) // NOLINT(readability-implicit-bool-conversion)
+
+    return -1; // Wait until any of the fds, including the bus timer, gets ready
+}
+
+bool Connection::waitForNextEventWithIoUring(bool sleep)
+{
+    constexpr std::size_t maxCompletions = 16;
+    std::array<IoUring::Completion, maxCompletions> completions{};
+
+    while (true)
     {
-        auto cleared = loopExitFd_.clear();
-        SDBUS_THROW_ERROR_IF(!cleared, "Failed to read from the loop exit descriptor", -errno);
-        return false;
+        auto sdbusPollData = getEventLoopPollData();
+        armIoUringPolls(sdbusPollData);
+
+        // Submission of re-armed polls and waiting for completions happen in one system call.
+        // The sd-bus timeout is passed along as the wait timeout, so no timer fd is needed.
+        ioUring_->submitAndWait(sleep ? sdbusPollData.getRelativeTimeout() : std::chrono::microseconds::zero());
+
+        auto count = ioUring_->reapCompletions(completions.data(), maxCompletions);
+        if (sleep)
+            statistics_.recordPollWakeup();
+        if (count == 0)
+            return true; // Timeout, pending messages in the inbound queue, or interrupted by a signal
+
+        bool busEvent{};
+        bool wakeUpEvent{};
+        for (const auto& completion : std::span{completions.data(), count})
+        {
+            switch (completion.userData & EVENT_LOOP_TAG_MASK)
+            {
+                case BUS_FD_TAG:
+                    // Completion of a replaced poll is either a cancellation or a stale event, and is harmless anyway
+                    if ((completion.userData >> BUS_FD_GENERATION_SHIFT) == ioUringPolls_.busFdGeneration)
+                        ioUringPolls_.busFdArmed = false;
+                    busEvent = busEvent || completion.result != -ECANCELED;
+                    break;
+                case EVENT_FD_TAG:
+                {
+                    // Wake up notification, in order that we re-submit with freshly read PollData. Unlike with
+                    // level-triggered epoll, the completion may be stale: processPendingEvent() might have already
+                    // cleared the event fd after the poll had completed, in which case there's nothing to read.
+                    ioUringPolls_.eventFdArmed = false;
+                    auto cleared = eventFd_.clear();
+                    SDBUS_THROW_ERROR_IF(!cleared && errno != EAGAIN, "Failed to read from the event descriptor", -errno);
+                    wakeUpEvent = wakeUpEvent || cleared;
+                    break;
+                }
+                case LOOP_EXIT_FD_TAG:
+                {
+                    ioUringPolls_.loopExitFdArmed = false;
+                    auto cleared = loopExitFd_.clear();
+                    SDBUS_THROW_ERROR_IF(!cleared, "Failed to read from the loop exit descriptor", -errno);
+                    return false;
+                }
+                case USER_EVENT_SOURCES_TAG:
+                    ioUringPolls_.userEventSourcesArmed = false;
+                    invokeUserEventSources();
+                    break;
+                default:
+                    break; // Completion of a poll removal request
+            }
+        }
+
+        if (busEvent)
+            return true;
+        if (wakeUpEvent)
+            statistics_.recordSpuriousWakeup();
+        // Otherwise go wait again, with freshly calculated, up-to-date timeout and with up-to-date events to watch
     }
+}
 
-    return true;
+void Connection::armIoUringPolls(const PollData& pollData)
+{
+    // Polls submitted to io_uring are one-shot, so only those that completed in the last iteration need to be re-armed
+    auto& polls = ioUringPolls_;
+    bool queued = true;
+
+    if (polls.busFdArmed && polls.busFdEvents != pollData.events)
+    {
+        queued = queued && ioUring_->queuePollRemoval(BUS_FD_TAG | (polls.busFdGeneration << BUS_FD_GENERATION_SHIFT), IGNORED_TAG);
+        polls.busFdArmed = false;
+    }
+    if (!polls.busFdArmed)
+    {
+        ++polls.busFdGeneration;
+        queued = queued && ioUring_->queuePoll(pollData.fd, pollData.events, BUS_FD_TAG | (polls.busFdGeneration << BUS_FD_GENERATION_SHIFT));
+        polls.busFdArmed = true;
+        polls.busFdEvents = pollData.events;
+    }
+    if (!polls.eventFdArmed)
+        queued = queued && (polls.eventFdArmed = ioUring_->queuePoll(eventFd_.fd, POLLIN, EVENT_FD_TAG));
+    if (!polls.loopExitFdArmed)
+        queued = queued && (polls.loopExitFdArmed = ioUring_->queuePoll(loopExitFd_.fd, POLLIN, LOOP_EXIT_FD_TAG));
+    if (!polls.userEventSourcesArmed)
+        queued = queued && (polls.userEventSourcesArmed = ioUring_->queuePoll(userEventSourcesEpoll_.fd, POLLIN, USER_EVENT_SOURCES_TAG));
+
+    // The submission queue is far bigger than the number of polls we ever have in flight
+    SDBUS_THROW_ERROR_IF(!queued, "Failed to queue io_uring poll request", EBUSY);
+}
+
+Slot Connection::addUserEventSource(std::shared_ptr<UserEventSource> source, uint32_t events)
+{
+    const std::lock_guard lock(userEventSourcesMutex_);
+
+    auto tag = nextUserEventSourceTag_++;
+    userEventSourcesEpoll_.add(source->fd, events, tag);
+    auto* rawSource = source.get();
+    userEventSources_.emplace(tag, std::move(source));
+
+    return {rawSource, [this, tag](void* /*source*/){ removeUserEventSource(tag); }};
+}
+
+void Connection::removeUserEventSource(uint64_t tag)
+{
+    const std::lock_guard lock(userEventSourcesMutex_);
+
+    auto it = userEventSources_.find(tag);
+    assert(it != userEventSources_.end());
+    userEventSourcesEpoll_.remove(it->second->fd);
+    userEventSources_.erase(it);
+}
+
+void Connection::invokeUserEventSources()
+{
+    constexpr int maxEvents = 16;
+    std::array<epoll_event, maxEvents> events{};
+
+    auto count = userEventSourcesEpoll_.wait(events.data(), maxEvents, 0);
+    for (const auto& event : std::span{events.data(), static_cast<std::size_t>(count)})
+        invokeUserEventSource(event.data.u64, event.events);
+}
+
+void Connection::invokeUserEventSource(uint64_t tag, uint32_t events)
+{
+    // The source is kept alive for the duration of the callback, even if its slot is destroyed meanwhile
+    std::shared_ptr<UserEventSource> source;
+    {
+        const std::lock_guard lock(userEventSourcesMutex_);
+        auto it = userEventSources_.find(tag);
+        if (it == userEventSources_.end())
+            return; // Removed in the meantime
+        source = it->second;
+    }
+
+    if (source->timer != nullptr)
+    {
+        if (source->timer->clear() > 0)
+            source->timerCallback();
+    }
+    else
+    {
+        source->fdCallback(Epoll::toPollEvents(events));
+    }
 }
 
 bool Connection::arePendingMessagesInQueues() const
@@ -875,13 +1656,79 @@ bool Connection::arePendingMessagesInQueues() const
 
     auto r = sdbus_->sd_bus_get_n_queued(bus_.get(), &readQueueSize, &writeQueueSize);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get number of pending messages in sd-bus queues", -r);
+    statistics_.recordQueueLengths(readQueueSize, writeQueueSize);
 
     return readQueueSize > 0 || writeQueueSize > 0;
 }
 
+void Connection::updateOutboundQueueState()
+{
+    if (outboundQueueHighWatermark_.load(std::memory_order_relaxed) == 0 && !outboundQueueCongested_.load(std::memory_order_relaxed))
+        return; // The outbound queue is unbounded, nothing to watch
+
+    // No lock may be held here: the queue length is read under the bus lock, which the event loop thread
+    // holds while dispatching handlers, and these handlers may send messages and get here, too.
+    auto queueLength = getOutboundQueueLength();
+    auto highWatermark = outboundQueueHighWatermark_.load(std::memory_order_relaxed);
+    auto lowWatermark = outboundQueueLowWatermark_.load(std::memory_order_relaxed);
+    auto congested = outboundQueueCongested_.load(std::memory_order_relaxed);
+
+    bool newCongested{};
+    if (!congested && highWatermark != 0 && queueLength >= highWatermark)
+        newCongested = true;
+    else if (congested && (highWatermark == 0 || queueLength <= lowWatermark))
+        newCongested = false;
+    else
+        return; // No transition
+
+    if (!outboundQueueCongested_.compare_exchange_strong(congested, newCongested))
+        return; // Another thread has just made this transition
+
+    deliverOutboundQueueState();
+}
+
+void Connection::deliverOutboundQueueState()
+{
+    std::unique_lock lock(outboundQueueHandlerMutex_);
+    if (outboundQueueDelivering_)
+        return; // The delivering thread re-reads the state after its handler call, so it delivers ours, too
+    outboundQueueDelivering_ = true;
+
+    try
+    {
+        // Transitions detected in different threads may race, so deliver the latest state until the handler has seen it
+        for (;;)
+        {
+            auto congested = outboundQueueCongested_.load();
+            if (congested == outboundQueueDeliveredCongested_)
+                break;
+            outboundQueueDeliveredCongested_ = congested;
+            auto handler = outboundQueueHandler_;
+
+            // Called outside of the lock, so the handler may send messages itself
+            lock.unlock();
+            if (handler)
+                handler(congested);
+            lock.lock();
+        }
+    }
+    catch (...)
+    {
+        if (!lock.owns_lock())
+            lock.lock();
+        outboundQueueDelivering_ = false;
+        throw;
+    }
+
+    outboundQueueDelivering_ = false;
+}
+
 Message Connection::getCurrentlyProcessedMessage() const
 {
-    auto* sdbusMsg = sdbus_->sd_bus_get_current_message(bus_.get());
+    // In a worker thread, the currently processed message is the one the handler has been dispatched for
+    auto* sdbusMsg = currentlyDispatchedMessage.connection == this
+                   ? currentlyDispatchedMessage.message
+                   : sdbus_->sd_bus_get_current_message(bus_.get());
 
     // TODO: const_cast..? Finish the const correctness design
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
@@ -899,6 +1746,32 @@ std::vector</*const */char*> Connection::to_strv(const std::vector<StringBasedTy
     return strv;
 }
 
+void Connection::recordDispatchStart(sd_bus_message* sdbusMsg)
+{
+    uint8_t type{};
+    (void)sd_bus_message_get_type(sdbusMsg, &type);
+    statistics_.recordReceived(type);
+    SDBUS_TRACEPOINT(message_received, traceCookie(sdbusMsg), type, sd_bus_message_get_member(sdbusMsg));
+
+    // The message is about to be dispatched to its handler
+    if (currentDispatchStart.connection == this && currentDispatchStart.time == std::chrono::steady_clock::time_point{})
+    {
+        currentDispatchStart.time = std::chrono::steady_clock::now();
+        if (auto* watchdog = watchdog_.load(std::memory_order_acquire); watchdog != nullptr && watchdog->isEnabled())
+            watchdog->dispatchStarted(sdbusMsg, currentDispatchStart.time);
+    }
+}
+
+int Connection::sdbus_dispatch_filter(sd_bus_message *sdbusMessage, void *userData, sd_bus_error */*retError*/)
+{
+    auto* connection = static_cast<Connection*>(userData);
+    assert(connection != nullptr);
+
+    connection->recordDispatchStart(sdbusMessage);
+
+    return 0; // Let sd-bus dispatch the message further
+}
+
 int Connection::sdbus_match_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
 {
     auto* matchInfo = static_cast<MatchInfo*>(userData);
@@ -907,11 +1780,26 @@ int Connection::sdbus_match_callback(sd_bus_message *sdbusMessage, void *userDat
 
     auto message = Message::Factory::create<PlainMessage>(sdbusMessage, &matchInfo->connection);
 
-    auto ok = invokeHandlerAndCatchErrors([&](){ matchInfo->callback(std::move(message)); }, retError);
+    auto ok = invokeHandlerAndCatchErrors([&]()
+    {
+        // With an executor, the callback is invoked in the executor's context
+        if (matchInfo->executor)
+            matchInfo->executor.post(std::move(message));
+        else
+            matchInfo->callback(std::move(message));
+    }, retError);
 
     return ok ? 0 : -1;
 }
 
+void Connection::invokePostedMatchCallback(void* userData, Message&& message)
+{
+    auto* matchInfo = static_cast<MatchInfo*>(userData);
+    assert(matchInfo != nullptr);
+
+    matchInfo->callback(Message::Factory::create<PlainMessage>(std::move(message)));
+}
+
 int Connection::sdbus_match_install_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
 {
     auto* matchInfo = static_cast<MatchInfo*>(userData);
@@ -925,6 +1813,21 @@ int Connection::sdbus_match_install_callback(sd_bus_message *sdbusMessage, void
     return ok ? 0 : -1;
 }
 
+int Connection::sdbus_sync_call_reply_handler(sd_bus_message *sdbusMessage, void *userData, sd_bus_error */*retError*/)
+{
+    auto* call = static_cast<PendingSyncCall*>(userData);
+    assert(call != nullptr);
+
+    call->connection.recordDispatchStart(sdbusMessage);
+    auto* sdbusReply = call->connection.incrementMessageRefCount(sdbusMessage);
+
+    const std::lock_guard lock(call->mutex);
+    call->reply = sdbusReply;
+    call->cond.notify_one();
+
+    return 0;
+}
+
 Connection::EventFd::EventFd()
     : fd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
 {
@@ -933,13 +1836,15 @@ Connection::EventFd::EventFd()
 
 Connection::EventFd::~EventFd()
 {
-    assert(fd >= 0);
-    close(fd);
+    if (fd >= 0)
+        close(fd);
 }
 
 void Connection::EventFd::notify() // NOLINT(readability-make-member-function-const)
 {
-    assert(fd >= 0);
+    if (fd < 0)
+        return; // A pseudo connection has no event loop to notify
+
     auto r = eventfd_write(fd, 1);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to notify event descriptor", -errno);
 }
@@ -981,6 +1886,16 @@ int IConnection::PollData::getPollTimeout() const
     return static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(relativeTimeout).count());
 }
 
+void IConnection::sendBatch(const std::vector<Message>& messages)
+{
+    sendBatch(messages.data(), messages.size());
+}
+
+void IConnection::sendBatch(std::span<const Message> messages)
+{
+    sendBatch(messages.data(), messages.size());
+}
+
 } // namespace sdbus
 
 namespace sdbus::internal {
@@ -1010,6 +1925,12 @@ std::unique_ptr<IConnection> createBusConnection(const ServiceName& name)
     return conn;
 }
 
+std::unique_ptr<IConnection> createBusConnection(single_threaded_t)
+{
+    auto interface = std::make_unique<internal::SingleThreadedSdBus>();
+    return std::make_unique<internal::Connection>(std::move(interface), Connection::default_bus);
+}
+
 std::unique_ptr<IConnection> createSystemBusConnection()
 {
     auto interface = std::make_unique<internal::SdBus>();
@@ -1023,6 +1944,12 @@ std::unique_ptr<IConnection> createSystemBusConnection(const ServiceName& name)
     return conn;
 }
 
+std::unique_ptr<IConnection> createSystemBusConnection(single_threaded_t)
+{
+    auto interface = std::make_unique<internal::SingleThreadedSdBus>();
+    return std::make_unique<internal::Connection>(std::move(interface), Connection::system_bus);
+}
+
 std::unique_ptr<IConnection> createSessionBusConnection()
 {
     auto interface = std::make_unique<internal::SdBus>();
@@ -1036,6 +1963,12 @@ std::unique_ptr<IConnection> createSessionBusConnection(const ServiceName& name)
     return conn;
 }
 
+std::unique_ptr<IConnection> createSessionBusConnection(single_threaded_t)
+{
+    auto interface = std::make_unique<internal::SingleThreadedSdBus>();
+    return std::make_unique<internal::Connection>(std::move(interface), Connection::session_bus);
+}
+
 std::unique_ptr<IConnection> createSessionBusConnectionWithAddress(const std::string &address)
 {
     auto interface = std::make_unique<internal::SdBus>();
@@ -1054,6 +1987,12 @@ std::unique_ptr<IConnection> createDirectBusConnection(const std::string& addres
     return std::make_unique<internal::Connection>(std::move(interface), Connection::private_bus, address);
 }
 
+std::unique_ptr<IConnection> createDirectBusConnection(const std::string& address, single_threaded_t)
+{
+    auto interface = std::make_unique<internal::SingleThreadedSdBus>();
+    return std::make_unique<internal::Connection>(std::move(interface), Connection::private_bus, address);
+}
+
 std::unique_ptr<IConnection> createDirectBusConnection(int fd)
 {
     auto interface = std::make_unique<internal::SdBus>();
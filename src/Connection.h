@@ -31,10 +31,25 @@
 
 #include "sdbus-c++/Message.h"
 
+#include "Epoll.h"
+#include "DispatchWatchdog.h"
+#include "ExecutorBinding.h"
 #include "IConnection.h"
+#include "IoUring.h"
 #include "ISdBus.h"
-
+#include "StatisticsCounters.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <string>
 #include SDBUS_HEADER
 #include <thread>
@@ -111,6 +126,32 @@ namespace sdbus::internal {
         void setMethodCallTimeout(uint64_t timeout) override;
         [[nodiscard]] uint64_t getMethodCallTimeout() const override;
 
+        void setNonBlockingMethodCalls(bool enabled) override;
+        [[nodiscard]] bool areMethodCallsNonBlocking() const override;
+
+        void setDispatchThreadCount(std::size_t threadCount) override;
+        [[nodiscard]] std::size_t getDispatchThreadCount() const override;
+
+        [[nodiscard]] Slot addFdWatch(int fd, short int events, fd_watch_handler callback, return_slot_t) override;
+        [[nodiscard]] Slot addTimer(std::chrono::microseconds interval, timer_handler callback, return_slot_t) override;
+        void setEventLoopBackend(EventLoopBackend backend) override;
+        [[nodiscard]] EventLoopBackend getEventLoopBackend() const override;
+        void setDispatchBudget(const DispatchBudget& budget) override;
+        [[nodiscard]] DispatchBudget getDispatchBudget() const override;
+        void setBusyPollWindow(std::chrono::microseconds window) override;
+        [[nodiscard]] std::chrono::microseconds getBusyPollWindow() const override;
+        void setOutboundQueueWatermarks(const OutboundQueueWatermarks& watermarks) override;
+        [[nodiscard]] OutboundQueueWatermarks getOutboundQueueWatermarks() const override;
+        void setOutboundQueueHandler(outbound_queue_handler handler) override;
+        [[nodiscard]] std::size_t getOutboundQueueLength() const override;
+        void sendBatch(const Message* messages, std::size_t count) override;
+        [[nodiscard]] Slot cork() override;
+        [[nodiscard]] Statistics getStatistics() const override;
+        void setDispatchWatchdog(std::chrono::microseconds threshold, dispatch_stall_handler handler) override;
+        [[nodiscard]] std::map<std::string, uint64_t> getDispatchStallCounts() const override;
+        void setCallbackExecutor(Executor executor) override;
+        [[nodiscard]] Executor getCallbackExecutor() const override;
+
         void addMatch(const std::string& match, message_handler callback) override;
         [[nodiscard]] Slot addMatch(const std::string& match, message_handler callback, return_slot_t) override;
         void addMatchAsync(const std::string& match, message_handler callback, message_handler installCallback) override;
@@ -118,6 +159,8 @@ namespace sdbus::internal {
                                         , message_handler callback
                                         , message_handler installCallback
                                         , return_slot_t ) override;
+        void addMatch(const std::string& match, message_handler callback, Executor executor) override;
+        [[nodiscard]] Slot addMatch(const std::string& match, message_handler callback, Executor executor, return_slot_t) override;
 
         void attachSdEventLoop(sd_event *event, int priority) override;
         void detachSdEventLoop() override;
@@ -166,6 +209,8 @@ namespace sdbus::internal {
                                   , void* userData
                                   , return_slot_t ) override;
 
+        void recordDispatchStart(sd_bus_message* sdbusMsg) override;
+
         sd_bus_message* incrementMessageRefCount(sd_bus_message* sdbusMsg) override;
         sd_bus_message* decrementMessageRefCount(sd_bus_message* sdbusMsg) override;
 
@@ -176,11 +221,16 @@ namespace sdbus::internal {
         sd_bus_message* callMethod(sd_bus_message* sdbusMsg, uint64_t timeout) override;
         Slot callMethodAsync(sd_bus_message* sdbusMsg, sd_bus_message_handler_t callback, void* userData, uint64_t timeout, return_slot_t) override;
         void sendMessage(sd_bus_message* sdbusMsg) override;
+        bool trySendMessage(sd_bus_message* sdbusMsg) override;
+
+        bool dispatchToWorkerThread(sd_bus_message* sdbusMsg, TaskGroup& tasks, Strand* strand, std::function<void()> handler) override;
 
         sd_bus_message* createMethodReply(sd_bus_message* sdbusMsg) override;
         sd_bus_message* createErrorReplyMessage(sd_bus_message* sdbusMsg, const Error& error) override;
 
     private:
+        static constexpr DispatchBudget DEFAULT_DISPATCH_BUDGET{64, std::chrono::milliseconds{1}};
+
         using BusFactory = std::function<int(sd_bus**)>;
         using BusPtr = std::unique_ptr<sd_bus, std::function<sd_bus*(sd_bus*)>>;
         Connection(std::unique_ptr<ISdBus>&& interface, const BusFactory& busFactory);
@@ -188,9 +238,34 @@ namespace sdbus::internal {
         BusPtr openBus(const std::function<int(sd_bus**)>& busFactory);
         BusPtr openPseudoBus();
         void finishHandshake(sd_bus* bus);
-        bool waitForNextEvent();
+        bool processPendingEvents();
+        bool processPendingEvent(std::chrono::steady_clock::time_point pickupTime);
+        int processBus(std::chrono::steady_clock::time_point pickupTime);
+        bool busyPollForNextEvent();
+        bool waitForNextEvent(bool sleep);
+        bool waitForNextEventWithEpoll(bool sleep);
+        bool waitForNextEventWithIoUring(bool sleep);
+        int updateEpollRegistrations(const PollData& pollData);
+        void armIoUringPolls(const PollData& pollData);
+
+        struct UserEventSource;
+        Slot addUserEventSource(std::shared_ptr<UserEventSource> source, uint32_t events);
+        void removeUserEventSource(uint64_t tag);
+        void invokeUserEventSources();
+        void invokeUserEventSource(uint64_t tag, uint32_t events);
+
+        struct PendingSyncCall;
+        void registerEventLoopThread();
+        void unregisterEventLoopThread();
+        bool registerPendingSyncCall(PendingSyncCall& call);
+        void unregisterPendingSyncCall(PendingSyncCall& call);
+        sd_bus_message* callMethodNonBlocking(sd_bus_message* sdbusMsg, uint64_t timeout, PendingSyncCall& call);
 
         [[nodiscard]] bool arePendingMessagesInQueues() const;
+        void updateOutboundQueueState();
+        void deliverOutboundQueueState();
+        void sendMessages(std::span<sd_bus_message* const> sdbusMsgs);
+        void countSentMessage(sd_bus_message* sdbusMsg) noexcept;
 
         void notifyEventLoopToExit();
         void notifyEventLoopToWakeUpFromPoll();
@@ -200,8 +275,11 @@ namespace sdbus::internal {
         template <typename StringBasedType>
         static std::vector</*const */char*> to_strv(const std::vector<StringBasedType>& strings);
 
+        static int sdbus_dispatch_filter(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
         static int sdbus_match_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
+        static void invokePostedMatchCallback(void* userData, Message&& message);
         static int sdbus_match_install_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
+        static int sdbus_sync_call_reply_handler(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
 
     
 #ifndef SDBUS_basu // sd_event integration is not supported if instead of libsystemd we are based on basu
@@ -220,6 +298,7 @@ namespace sdbus::internal {
         struct EventFd
         {
             EventFd();
+            explicit EventFd(no_fd_t) noexcept {}
             EventFd(const EventFd&) = delete;
             EventFd& operator=(const EventFd&) = delete;
             EventFd(EventFd&&) = delete;
@@ -236,9 +315,40 @@ namespace sdbus::internal {
             message_handler callback;
             message_handler installCallback;
             Connection& connection; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            ExecutorBinding executor; // Executor the callback is posted to, if any
             Slot slot;
         };
 
+        // Synchronous method call whose reply is delivered by the event loop thread
+        struct PendingSyncCall
+        {
+            Connection& connection; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            std::mutex mutex{};
+            std::condition_variable cond{};
+            sd_bus_message* reply{};
+            bool abandoned{}; // The event loop has been left before the reply arrived
+        };
+
+        // Application fd or timer served by the internal event loop
+        struct UserEventSource
+        {
+            int fd{-1};
+            std::unique_ptr<TimerFd> timer; // Owns the fd in case of a timer
+            fd_watch_handler fdCallback;
+            timer_handler timerCallback;
+        };
+
+        // State of readiness polls submitted to io_uring, accessed only by the event loop thread
+        struct IoUringPolls
+        {
+            bool busFdArmed{};
+            short int busFdEvents{};
+            uint64_t busFdGeneration{}; // Distinguishes completions of the current bus fd poll from replaced ones
+            bool eventFdArmed{};
+            bool loopExitFdArmed{};
+            bool userEventSourcesArmed{};
+        };
+
         // sd-event integration
         struct SdEvent
         {
@@ -249,12 +359,47 @@ namespace sdbus::internal {
         };
 
         std::unique_ptr<ISdBus> sdbus_;
+        bool singleThreaded_{}; // The sd-bus interface does no locking, see createBusConnection(single_threaded_t)
         BusPtr bus_;
+        Slot dispatchFilter_; // Counts, timestamps and watches messages dispatched by sd-bus
+        mutable StatisticsCounters statistics_;
         std::thread asyncLoopThread_;
         EventFd loopExitFd_; // To wake up event loop I/O polling to exit
         EventFd eventFd_; // To wake up event loop I/O polling to re-enter poll with fresh PollData values
+        Epoll epoll_; // Persistent registration of all fds the internal event loop waits on
+        TimerFd busTimerFd_; // Expires upon the sd-bus timeout, e.g. of a pending method call
+        int epollBusFd_{-1}; // Bus fd as currently registered in epoll, accessed only by the event loop thread
+        uint32_t epollBusEvents_{}; // Bus fd events as currently registered in epoll
+        std::chrono::microseconds busTimerExpiry_{std::chrono::microseconds::max()}; // Currently armed expiry of the bus timer
+        Epoll userEventSourcesEpoll_; // Nested in epoll_ (or polled by io_uring) as a single fd
+        std::mutex userEventSourcesMutex_;
+        std::map<uint64_t, std::shared_ptr<UserEventSource>> userEventSources_; // Keyed by their epoll tag
+        uint64_t nextUserEventSourceTag_{};
+        std::unique_ptr<IoUring> ioUring_; // Set if the io_uring event loop backend is in use
+        IoUringPolls ioUringPolls_;
+        std::atomic<std::size_t> dispatchBudgetMessages_{DEFAULT_DISPATCH_BUDGET.maxMessages};
+        std::atomic<std::chrono::microseconds> dispatchBudgetDuration_{DEFAULT_DISPATCH_BUDGET.maxDuration};
+        std::atomic<std::chrono::microseconds> busyPollWindow_{}; // Zero means no busy polling
+        mutable std::mutex callbackExecutorMutex_; // The executor may be set from any thread, while subscribing on another one
+        Executor callbackExecutor_; // Executor that callbacks are posted to, if any
+        std::mutex watchdogMutex_; // Guards creation of the watchdog
+        std::unique_ptr<DispatchWatchdog> watchdogOwner_; // Created upon first setDispatchWatchdog(), lives as long as the connection
+        std::atomic<DispatchWatchdog*> watchdog_{}; // Read by the dispatching thread without locking
+        std::atomic<std::size_t> outboundQueueHighWatermark_{}; // Zero means unbounded outbound queue
+        std::atomic<std::size_t> outboundQueueLowWatermark_{};
+        std::atomic<bool> outboundQueueCongested_{};
+        std::mutex outboundQueueHandlerMutex_;
+        outbound_queue_handler outboundQueueHandler_; // Guarded by outboundQueueHandlerMutex_
+        bool outboundQueueDelivering_{}; // Some thread is invoking the handler; guarded by outboundQueueHandlerMutex_
+        bool outboundQueueDeliveredCongested_{}; // State the handler has seen last; guarded by outboundQueueHandlerMutex_
+        std::atomic<bool> eventLoopInterrupted_{}; // Exit or wake-up requested while the event loop processes a batch of messages
         std::vector<Slot> floatingMatchRules_;
         std::unique_ptr<SdEvent> sdEvent_; // Integration of systemd sd-event event loop implementation
+        std::atomic<bool> nonBlockingMethodCalls_{false};
+        std::mutex syncCallsMutex_; // Guards eventLoopThreadId_ and pendingSyncCalls_
+        std::thread::id eventLoopThreadId_; // Id of the thread running the internal event loop, if any
+        std::vector<PendingSyncCall*> pendingSyncCalls_;
+        std::unique_ptr<ThreadPool> dispatchThreadPool_; // Worker threads for parallel dispatch of incoming messages
     };
 
 } // namespace sdbus::internal
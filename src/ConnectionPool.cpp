@@ -0,0 +1,151 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file ConnectionPool.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdbus-c++/ConnectionPool.h"
+
+#include "sdbus-c++/Error.h"
+
+#include <cerrno>
+#include <functional>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sdbus {
+
+namespace {
+
+// CPU cores the calling thread (and thus, typically, the process) is allowed to run on
+std::vector<int> getAllowedCpuCores()
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) < 0)
+        return {};
+
+    std::vector<int> cores;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, &cpuSet))
+            cores.push_back(cpu);
+    return cores;
+}
+
+void pinCurrentThreadToCpuCore(int core)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core, &cpuSet);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet); // Best effort, we run unpinned otherwise
+}
+
+} // namespace
+
+ConnectionPool::ConnectionPool(std::size_t shardCount, ConnectionFactory connectionFactory, ShardingPolicy shardingPolicy)
+    : shardingPolicy_(shardingPolicy ? std::move(shardingPolicy) : ShardingPolicy{&ConnectionPool::hashObjectPath})
+{
+    SDBUS_THROW_ERROR_IF(shardCount == 0, "Invalid number of connection pool shards", EINVAL);
+
+    if (!connectionFactory)
+        connectionFactory = [](){ return createBusConnection(); };
+
+    connections_.reserve(shardCount);
+    for (std::size_t i = 0; i < shardCount; ++i)
+        connections_.push_back(connectionFactory());
+}
+
+ConnectionPool::~ConnectionPool()
+{
+    try
+    {
+        leaveEventLoops();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {
+    }
+}
+
+void ConnectionPool::enterEventLoopsAsync(bool pinToCores)
+{
+    if (!eventLoopThreads_.empty())
+        return; // Already running
+
+    auto cores = pinToCores ? getAllowedCpuCores() : std::vector<int>{};
+
+    eventLoopThreads_.reserve(connections_.size());
+    for (std::size_t i = 0; i < connections_.size(); ++i)
+    {
+        auto core = cores.empty() ? -1 : cores[i % cores.size()];
+        eventLoopThreads_.emplace_back([&connection = *connections_[i], core]()
+        {
+            if (core >= 0)
+                pinCurrentThreadToCpuCore(core);
+            connection.enterEventLoop();
+        });
+    }
+}
+
+void ConnectionPool::leaveEventLoops()
+{
+    // Event loops run in our threads, so leaving them doesn't join anything, we join the threads here
+    for (std::size_t i = 0; i < eventLoopThreads_.size(); ++i)
+        connections_[i]->leaveEventLoop();
+
+    for (auto& thread : eventLoopThreads_)
+        thread.join();
+    eventLoopThreads_.clear();
+}
+
+std::size_t ConnectionPool::size() const
+{
+    return connections_.size();
+}
+
+IConnection& ConnectionPool::getConnection(std::size_t shard) const
+{
+    SDBUS_THROW_ERROR_IF(shard >= connections_.size(), "Invalid connection pool shard index", EINVAL);
+
+    return *connections_[shard];
+}
+
+std::size_t ConnectionPool::getShardFor(const ObjectPath& objectPath) const
+{
+    // The policy is free to return any number, we fold it into the range of shards
+    return shardingPolicy_(objectPath, connections_.size()) % connections_.size();
+}
+
+IConnection& ConnectionPool::getConnectionFor(const ObjectPath& objectPath) const
+{
+    return *connections_[getShardFor(objectPath)];
+}
+
+std::size_t ConnectionPool::hashObjectPath(const ObjectPath& objectPath, std::size_t shardCount)
+{
+    return std::hash<std::string>{}(objectPath) % shardCount;
+}
+
+} // namespace sdbus
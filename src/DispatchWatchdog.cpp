@@ -0,0 +1,143 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file DispatchWatchdog.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DispatchWatchdog.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace sdbus::internal {
+
+namespace {
+
+std::string toString(const char* str)
+{
+    return str != nullptr ? std::string{str} : std::string{};
+}
+
+} // namespace
+
+DispatchWatchdog::DispatchWatchdog()
+    : thread_([this](){ run(); })
+{
+}
+
+DispatchWatchdog::~DispatchWatchdog()
+{
+    {
+        const std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    cond_.notify_one();
+    thread_.join();
+}
+
+void DispatchWatchdog::configure(std::chrono::microseconds threshold, StallHandler handler)
+{
+    {
+        const std::lock_guard lock(mutex_);
+        threshold_ = threshold;
+        handler_ = std::move(handler);
+        enabled_.store(threshold != std::chrono::microseconds::zero(), std::memory_order_relaxed);
+    }
+    cond_.notify_one();
+}
+
+bool DispatchWatchdog::isEnabled() const noexcept
+{
+    return enabled_.load(std::memory_order_relaxed);
+}
+
+void DispatchWatchdog::dispatchStarted(sd_bus_message* sdbusMsg, std::chrono::steady_clock::time_point start)
+{
+    // sd-bus drops the message before the dispatch is finished from our point of view, so nothing may point into it
+    Stall message{ toString(sd_bus_message_get_interface(sdbusMsg))
+                 , toString(sd_bus_message_get_member(sdbusMsg))
+                 , toString(sd_bus_message_get_path(sdbusMsg))
+                 , toString(sd_bus_message_get_sender(sdbusMsg))
+                 , {} };
+
+    const std::lock_guard lock(mutex_);
+    message_ = std::move(message);
+    dispatching_ = true;
+    dispatchStart_ = start;
+    reported_ = false;
+}
+
+void DispatchWatchdog::dispatchFinished()
+{
+    const std::lock_guard lock(mutex_);
+    dispatching_ = false;
+}
+
+std::map<std::string, uint64_t> DispatchWatchdog::getStallCounts() const
+{
+    const std::lock_guard lock(mutex_);
+    return stallCounts_;
+}
+
+void DispatchWatchdog::run()
+{
+    std::unique_lock lock(mutex_);
+
+    while (!stopping_)
+    {
+        if (threshold_ == std::chrono::microseconds::zero())
+        {
+            cond_.wait(lock);
+            continue;
+        }
+
+        cond_.wait_for(lock, std::max(threshold_ / 2, std::chrono::microseconds{1}));
+        if (stopping_ || !dispatching_ || reported_ || threshold_ == std::chrono::microseconds::zero())
+            continue;
+
+        auto duration = std::chrono::steady_clock::now() - dispatchStart_;
+        if (duration < threshold_)
+            continue;
+
+        auto stall = message_;
+        stall.duration = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+        ++stallCounts_[stall.interfaceName + "." + stall.memberName];
+        reported_ = true;
+
+        // The slow dispatch may finish in the meantime, but the handler gets a copy of everything it needs
+        auto handler = handler_;
+        lock.unlock();
+        try
+        {
+            if (handler)
+                handler(stall);
+        }
+        catch (...) // NOLINT(bugprone-empty-catch)
+        {
+            // There is nobody to report the failure to, and the watchdog shall keep running
+        }
+        lock.lock();
+    }
+}
+
+} // namespace sdbus::internal
@@ -0,0 +1,87 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file DispatchWatchdog.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_DISPATCHWATCHDOG_H_
+#define SDBUS_CXX_INTERNAL_DISPATCHWATCHDOG_H_
+
+#include "sdbus-c++/IConnection.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include SDBUS_HEADER
+#include <thread>
+
+namespace sdbus::internal {
+
+    // Watches the dispatch of messages from a thread of its own, and reports dispatches
+    // that have been running for longer than a threshold, see IConnection::setDispatchWatchdog().
+    class DispatchWatchdog
+    {
+    public:
+        using Stall = sdbus::IConnection::DispatchStall;
+        using StallHandler = sdbus::IConnection::dispatch_stall_handler;
+
+        DispatchWatchdog();
+        DispatchWatchdog(const DispatchWatchdog&) = delete;
+        DispatchWatchdog& operator=(const DispatchWatchdog&) = delete;
+        DispatchWatchdog(DispatchWatchdog&&) = delete;
+        DispatchWatchdog& operator=(DispatchWatchdog&&) = delete;
+        ~DispatchWatchdog(); // Joins the watchdog thread
+
+        void configure(std::chrono::microseconds threshold, StallHandler handler);
+        [[nodiscard]] bool isEnabled() const noexcept;
+
+        // Called by the dispatching thread. The message is only read in this call, sd-bus may free it before dispatchFinished().
+        void dispatchStarted(sd_bus_message* sdbusMsg, std::chrono::steady_clock::time_point start);
+        void dispatchFinished();
+
+        [[nodiscard]] std::map<std::string, uint64_t> getStallCounts() const;
+
+    private:
+        void run();
+
+        mutable std::mutex mutex_;
+        std::condition_variable cond_;
+        std::atomic<bool> enabled_{};
+        std::chrono::microseconds threshold_{};
+        StallHandler handler_;
+        bool dispatching_{}; // A message is being dispatched
+        Stall message_; // Description of the message being dispatched, with no duration filled in
+        std::chrono::steady_clock::time_point dispatchStart_;
+        bool reported_{}; // The current dispatch has been reported already
+        std::map<std::string, uint64_t> stallCounts_;
+        bool stopping_{};
+        std::thread thread_;
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_DISPATCHWATCHDOG_H_ */
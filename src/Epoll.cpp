@@ -0,0 +1,175 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Epoll.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Epoll.h"
+
+#include "sdbus-c++/Error.h"
+
+#include <cerrno>
+#include <poll.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace sdbus::internal {
+
+namespace {
+
+timespec toTimespec(std::chrono::microseconds time)
+{
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(time);
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time - seconds);
+    return {static_cast<time_t>(seconds.count()), static_cast<long>(nanoseconds.count())};
+}
+
+} // namespace
+
+Epoll::Epoll()
+    : fd(epoll_create1(EPOLL_CLOEXEC))
+{
+    SDBUS_THROW_ERROR_IF(fd < 0, "Failed to create epoll instance", -errno);
+}
+
+Epoll::~Epoll()
+{
+    if (fd >= 0)
+        close(fd);
+}
+
+void Epoll::add(int fd, uint32_t events, uint64_t tag) // NOLINT(readability-make-member-function-const)
+{
+    epoll_event event{};
+    event.events = events;
+    event.data.u64 = tag;
+
+    auto r = epoll_ctl(this->fd, EPOLL_CTL_ADD, fd, &event);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to add file descriptor to epoll", -errno);
+}
+
+void Epoll::modify(int fd, uint32_t events, uint64_t tag) // NOLINT(readability-make-member-function-const)
+{
+    epoll_event event{};
+    event.events = events;
+    event.data.u64 = tag;
+
+    auto r = epoll_ctl(this->fd, EPOLL_CTL_MOD, fd, &event);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to modify file descriptor in epoll", -errno);
+}
+
+void Epoll::remove(int fd) noexcept // NOLINT(readability-make-member-function-const)
+{
+    // May legitimately fail if the fd has already been closed, in which case epoll removed it on its own
+    (void)epoll_ctl(this->fd, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+int Epoll::wait(epoll_event* events, int maxEvents, int timeout) // NOLINT(readability-make-member-function-const)
+{
+    auto r = epoll_wait(fd, events, maxEvents, timeout);
+
+    if (r < 0 && errno == EINTR)
+        return 0;
+
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to wait on epoll", -errno);
+
+    return r;
+}
+
+uint32_t Epoll::toEpollEvents(short int pollEvents)
+{
+    uint32_t events{};
+    if (pollEvents & POLLIN) // NOLINT(readability-implicit-bool-conversion,hicpp-signed-bitwise)
+        events |= EPOLLIN;
+    if (pollEvents & POLLOUT) // NOLINT(readability-implicit-bool-conversion,hicpp-signed-bitwise)
+        events |= EPOLLOUT;
+    if (pollEvents & POLLPRI) // NOLINT(readability-implicit-bool-conversion,hicpp-signed-bitwise)
+        events |= EPOLLPRI;
+    return events;
+}
+
+short int Epoll::toPollEvents(uint32_t epollEvents)
+{
+    short int events{};
+    if (epollEvents & EPOLLIN) // NOLINT(readability-implicit-bool-conversion)
+        events |= POLLIN; // NOLINT(hicpp-signed-bitwise)
+    if (epollEvents & EPOLLOUT) // NOLINT(readability-implicit-bool-conversion)
+        events |= POLLOUT; // NOLINT(hicpp-signed-bitwise)
+    if (epollEvents & EPOLLPRI) // NOLINT(readability-implicit-bool-conversion)
+        events |= POLLPRI; // NOLINT(hicpp-signed-bitwise)
+    if (epollEvents & EPOLLERR) // NOLINT(readability-implicit-bool-conversion)
+        events |= POLLERR; // NOLINT(hicpp-signed-bitwise)
+    if (epollEvents & EPOLLHUP) // NOLINT(readability-implicit-bool-conversion)
+        events |= POLLHUP; // NOLINT(hicpp-signed-bitwise)
+    return events;
+}
+
+TimerFd::TimerFd()
+    : fd(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK))
+{
+    SDBUS_THROW_ERROR_IF(fd < 0, "Failed to create timer descriptor", -errno);
+}
+
+TimerFd::~TimerFd()
+{
+    if (fd >= 0)
+        close(fd);
+}
+
+void TimerFd::armAt(std::chrono::microseconds time) // NOLINT(readability-make-member-function-const)
+{
+    // A zero it_value would disarm the timer, so an already elapsed time is pushed to the smallest valid one
+    itimerspec spec{};
+    spec.it_value = time.count() > 0 ? toTimespec(time) : timespec{0, 1};
+
+    auto r = timerfd_settime(fd, TFD_TIMER_ABSTIME, &spec, nullptr);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to arm timer descriptor", -errno);
+}
+
+void TimerFd::armPeriodic(std::chrono::microseconds interval) // NOLINT(readability-make-member-function-const)
+{
+    SDBUS_THROW_ERROR_IF(interval.count() <= 0, "Invalid timer interval", EINVAL);
+
+    itimerspec spec{};
+    spec.it_value = toTimespec(interval);
+    spec.it_interval = spec.it_value;
+
+    auto r = timerfd_settime(fd, 0, &spec, nullptr);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to arm timer descriptor", -errno);
+}
+
+void TimerFd::disarm() // NOLINT(readability-make-member-function-const)
+{
+    itimerspec spec{};
+    auto r = timerfd_settime(fd, 0, &spec, nullptr);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to disarm timer descriptor", -errno);
+}
+
+uint64_t TimerFd::clear() // NOLINT(readability-make-member-function-const)
+{
+    uint64_t expirations{};
+    auto r = read(fd, &expirations, sizeof(expirations));
+    return r == sizeof(expirations) ? expirations : 0;
+}
+
+} // namespace sdbus::internal
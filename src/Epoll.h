@@ -0,0 +1,90 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Epoll.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_EPOLL_H_
+#define SDBUS_CXX_INTERNAL_EPOLL_H_
+
+#include <chrono>
+#include <cstdint>
+#include <sys/epoll.h>
+
+namespace sdbus::internal {
+
+    // Tag of fd wrappers that own no fd, as used by pseudo connections, which never run an event loop
+    struct no_fd_t { explicit no_fd_t() = default; };
+    inline constexpr no_fd_t no_fd{};
+
+    // RAII wrapper of an epoll instance. File descriptors stay registered across waits,
+    // each one identified by a user-defined tag that is reported back upon its events.
+    class Epoll
+    {
+    public:
+        Epoll();
+        explicit Epoll(no_fd_t) noexcept {}
+        Epoll(const Epoll&) = delete;
+        Epoll& operator=(const Epoll&) = delete;
+        Epoll(Epoll&&) = delete;
+        Epoll& operator=(Epoll&&) = delete;
+        ~Epoll();
+
+        void add(int fd, uint32_t events, uint64_t tag);
+        void modify(int fd, uint32_t events, uint64_t tag);
+        void remove(int fd) noexcept;
+        // Returns the number of events stored to the array, 0 also when interrupted by a signal
+        int wait(epoll_event* events, int maxEvents, int timeout);
+
+        static uint32_t toEpollEvents(short int pollEvents);
+        static short int toPollEvents(uint32_t epollEvents);
+
+        int fd{-1};
+    };
+
+    // RAII wrapper of a non-blocking timerfd based on CLOCK_MONOTONIC
+    class TimerFd
+    {
+    public:
+        TimerFd();
+        explicit TimerFd(no_fd_t) noexcept {}
+        TimerFd(const TimerFd&) = delete;
+        TimerFd& operator=(const TimerFd&) = delete;
+        TimerFd(TimerFd&&) = delete;
+        TimerFd& operator=(TimerFd&&) = delete;
+        ~TimerFd();
+
+        // Arms the timer to expire at the given absolute CLOCK_MONOTONIC time
+        void armAt(std::chrono::microseconds time);
+        // Arms the timer to expire periodically, first time after one interval from now
+        void armPeriodic(std::chrono::microseconds interval);
+        void disarm();
+        // Returns the number of expirations since the last clear, 0 if none
+        uint64_t clear();
+
+        int fd{-1};
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_EPOLL_H_ */
@@ -0,0 +1,105 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Executor.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdbus-c++/Executor.h"
+
+#include "ExecutorBinding.h"
+
+#include <cassert>
+#include <utility>
+
+namespace sdbus {
+
+PostedCallback::PostedCallback(std::shared_ptr<internal::PostedCallbackGuard> guard, Message message) noexcept
+    : guard_(std::move(guard))
+    , message_(std::move(message))
+{
+}
+
+void PostedCallback::operator()()
+{
+    assert(guard_ != nullptr);
+
+    guard_->invoke(std::move(message_));
+}
+
+} // namespace sdbus
+
+namespace sdbus::internal {
+
+void PostedCallbackGuard::invoke(Message&& message)
+{
+    const std::lock_guard lock(mutex);
+    if (revoked)
+        return;
+
+    try
+    {
+        invoker(subscription, std::move(message));
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {
+        // Same as in the event loop thread, where sd-bus just ignores callback handler errors
+    }
+}
+
+void PostedCallbackGuard::revoke()
+{
+    // Callbacks may cancel their own subscription, that's why the mutex is recursive
+    const std::lock_guard lock(mutex);
+    revoked = true;
+}
+
+ExecutorBinding::ExecutorBinding(Executor executor, void* subscription, PostedCallbackGuard::Invoker invoker)
+    : executor_(executor)
+{
+    if (!executor_)
+        return;
+
+    guard_ = std::make_shared<PostedCallbackGuard>();
+    guard_->subscription = subscription;
+    guard_->invoker = invoker;
+}
+
+ExecutorBinding::~ExecutorBinding()
+{
+    if (guard_ != nullptr)
+        guard_->revoke();
+}
+
+ExecutorBinding::operator bool() const noexcept
+{
+    return guard_ != nullptr;
+}
+
+void ExecutorBinding::post(Message&& message)
+{
+    assert(guard_ != nullptr);
+
+    executor_.post(PostedCallback{guard_, std::move(message)});
+}
+
+} // namespace sdbus::internal
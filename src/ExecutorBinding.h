@@ -0,0 +1,78 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file ExecutorBinding.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_EXECUTORBINDING_H_
+#define SDBUS_CXX_INTERNAL_EXECUTORBINDING_H_
+
+#include "sdbus-c++/Executor.h"
+#include "sdbus-c++/Message.h"
+
+#include <memory>
+#include <mutex>
+
+namespace sdbus::internal {
+
+    // State shared by a subscription and the callbacks it has posted to an executor. Once the
+    // subscription goes away, it revokes the state, turning its callbacks still queued into no-ops.
+    struct PostedCallbackGuard
+    {
+        using Invoker = void (*)(void* subscription, Message&& message);
+
+        void invoke(Message&& message);
+        void revoke();
+
+        std::recursive_mutex mutex; // Held while a callback runs, so that revoke() waits for it to finish
+        bool revoked{};
+        void* subscription{};
+        Invoker invoker{};
+    };
+
+    // Binds a subscription (a signal handler, a match rule, a pending async call) to the executor its callbacks
+    // are posted to. It shall be destroyed after the sd-bus slot of the subscription, so that no more callbacks
+    // get posted once it revokes the posted ones.
+    class ExecutorBinding
+    {
+    public:
+        ExecutorBinding() = default;
+        ExecutorBinding(Executor executor, void* subscription, PostedCallbackGuard::Invoker invoker);
+        ExecutorBinding(const ExecutorBinding&) = delete;
+        ExecutorBinding& operator=(const ExecutorBinding&) = delete;
+        ExecutorBinding(ExecutorBinding&&) = default; // Moving is only meant for a binding that has posted nothing yet
+        ExecutorBinding& operator=(ExecutorBinding&&) = default;
+        ~ExecutorBinding(); // Waits for a running callback, and revokes the queued ones
+
+        // Without an executor, the caller shall invoke the callback in the current thread instead of posting it
+        explicit operator bool() const noexcept;
+        void post(Message&& message);
+
+    private:
+        Executor executor_;
+        std::shared_ptr<PostedCallbackGuard> guard_;
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_EXECUTORBINDING_H_ */
@@ -31,6 +31,7 @@
 
 #include "sdbus-c++/TypeTraits.h"
 
+#include <functional>
 #include <memory>
 #include SDBUS_HEADER
 #include <vector>
@@ -52,6 +53,8 @@ namespace sdbus {
     class Error;
     namespace internal {
         class ISdBus;
+        class Strand;
+        class TaskGroup;
     } // namespace internal
 } // namespace sdbus
 
@@ -106,6 +109,10 @@ namespace sdbus::internal {
                                                         , void* userData
                                                         , return_slot_t ) = 0;
 
+        // Replies to pending calls bypass the sd-bus filter that counts and times received messages, so their
+        // handlers report themselves upon invocation, see IConnection::getStatistics()
+        virtual void recordDispatchStart(sd_bus_message* sdbusMsg) = 0;
+
         virtual sd_bus_message* incrementMessageRefCount(sd_bus_message* sdbusMsg) = 0;
         virtual sd_bus_message* decrementMessageRefCount(sd_bus_message* sdbusMsg) = 0;
 
@@ -121,6 +128,13 @@ namespace sdbus::internal {
                                                   , uint64_t timeout
                                                   , return_slot_t ) = 0;
         virtual void sendMessage(sd_bus_message* sdbusMsg) = 0;
+        // Sends the message unless the outbound queue is at or above its high watermark, in which case it returns false
+        virtual bool trySendMessage(sd_bus_message* sdbusMsg) = 0;
+
+        // Dispatches the handler of the message to a worker thread, if parallel dispatch is enabled on the connection.
+        // Returns false if it's not, in which case the caller shall invoke the handler in the current thread.
+        // Handlers dispatched through the same strand are invoked one at a time, in the order of their messages.
+        virtual bool dispatchToWorkerThread(sd_bus_message* sdbusMsg, TaskGroup& tasks, Strand* strand, std::function<void()> handler) = 0;
 
         virtual sd_bus_message* createMethodReply(sd_bus_message* sdbusMsg) = 0;
         virtual sd_bus_message* createErrorReplyMessage(sd_bus_message* sdbusMsg, const Error& error) = 0;
@@ -0,0 +1,254 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file IoUring.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IoUring.h"
+
+#include "sdbus-c++/Error.h"
+
+#include <cerrno>
+
+#ifdef SDBUSCPP_IO_URING
+
+#include "ScopeGuard.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <ctime>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace sdbus::internal {
+
+namespace {
+
+template <typename T>
+T* ringPointer(void* ring, uint32_t offset)
+{
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+} // namespace
+
+IoUring::IoUring(unsigned int entries)
+{
+    io_uring_params params{};
+    fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    SDBUS_THROW_ERROR_IF(fd_ < 0, "Failed to set up io_uring", -errno);
+
+    SCOPE_EXIT_FAILURE{ release(); };
+
+    features_ = params.features;
+    // Wait timeouts are passed directly to io_uring_enter(), which needs Linux 5.11 or newer
+    SDBUS_THROW_ERROR_IF((features_ & IORING_FEAT_EXT_ARG) == 0, "io_uring doesn't support wait timeouts", ENOTSUP);
+
+    sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if ((features_ & IORING_FEAT_SINGLE_MMAP) != 0)
+        sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+
+    sqRing_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+    SDBUS_THROW_ERROR_IF(sqRing_ == MAP_FAILED, "Failed to map io_uring submission queue", -errno);
+    if ((features_ & IORING_FEAT_SINGLE_MMAP) != 0)
+    {
+        cqRing_ = sqRing_;
+    }
+    else
+    {
+        cqRing_ = mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+        SDBUS_THROW_ERROR_IF(cqRing_ == MAP_FAILED, "Failed to map io_uring completion queue", -errno);
+    }
+    sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+    auto* sqes = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+    SDBUS_THROW_ERROR_IF(sqes == MAP_FAILED, "Failed to map io_uring submission queue entries", -errno);
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    sqHead_ = ringPointer<unsigned int>(sqRing_, params.sq_off.head);
+    sqTail_ = ringPointer<unsigned int>(sqRing_, params.sq_off.tail);
+    sqArray_ = ringPointer<unsigned int>(sqRing_, params.sq_off.array);
+    sqMask_ = *ringPointer<unsigned int>(sqRing_, params.sq_off.ring_mask);
+    sqEntries_ = *ringPointer<unsigned int>(sqRing_, params.sq_off.ring_entries);
+    sqLocalTail_ = *sqTail_;
+    cqHead_ = ringPointer<unsigned int>(cqRing_, params.cq_off.head);
+    cqTail_ = ringPointer<unsigned int>(cqRing_, params.cq_off.tail);
+    cqes_ = ringPointer<io_uring_cqe>(cqRing_, params.cq_off.cqes);
+    cqMask_ = *ringPointer<unsigned int>(cqRing_, params.cq_off.ring_mask);
+}
+
+IoUring::~IoUring()
+{
+    release();
+}
+
+void IoUring::release() noexcept
+{
+    if (sqes_ != nullptr)
+        munmap(sqes_, sqesSize_);
+    if (cqRing_ != nullptr && cqRing_ != MAP_FAILED && cqRing_ != sqRing_)
+        munmap(cqRing_, cqRingSize_);
+    if (sqRing_ != nullptr && sqRing_ != MAP_FAILED)
+        munmap(sqRing_, sqRingSize_);
+    if (fd_ >= 0)
+        close(fd_);
+}
+
+bool IoUring::queuePoll(int fd, short int events, uint64_t userData)
+{
+    auto* sqe = getSqe();
+    if (sqe == nullptr)
+        return false;
+
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+    sqe->poll32_events = static_cast<uint16_t>(events);
+    sqe->user_data = userData;
+    return true;
+}
+
+bool IoUring::queuePollRemoval(uint64_t pollUserData, uint64_t userData)
+{
+    auto* sqe = getSqe();
+    if (sqe == nullptr)
+        return false;
+
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = pollUserData;
+    sqe->user_data = userData;
+    return true;
+}
+
+void IoUring::submitAndWait(std::chrono::microseconds timeout)
+{
+    // Publish queued requests to the kernel. We are the only producer, so a release store is enough.
+    auto toSubmit = sqLocalTail_ - *sqTail_;
+    std::atomic_ref(*sqTail_).store(sqLocalTail_, std::memory_order_release);
+
+    unsigned int flags = IORING_ENTER_GETEVENTS;
+    unsigned int waitNr = timeout == std::chrono::microseconds::zero() ? 0 : 1;
+    __kernel_timespec ts{};
+    io_uring_getevents_arg arg{};
+    if (timeout != std::chrono::microseconds::max() && waitNr > 0)
+    {
+        ts.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(timeout).count();
+        ts.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout % std::chrono::seconds(1)).count();
+        arg.ts = reinterpret_cast<uint64_t>(&ts); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        flags |= IORING_ENTER_EXT_ARG;
+    }
+
+    if (toSubmit == 0 && waitNr == 0)
+        return; // Nothing to do, completions (if any) can be reaped right away
+
+    auto r = syscall( __NR_io_uring_enter
+                    , fd_
+                    , toSubmit
+                    , waitNr
+                    , flags
+                    , (flags & IORING_ENTER_EXT_ARG) != 0 ? &arg : nullptr
+                    , sizeof(arg) );
+
+    // Timeout expiration and signal interruption are regular wake-ups of the event loop
+    if (r < 0 && (errno == ETIME || errno == EINTR))
+        return;
+
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to submit to io_uring", -errno);
+}
+
+std::size_t IoUring::reapCompletions(Completion* completions, std::size_t maxCompletions)
+{
+    auto head = *cqHead_;
+    auto tail = std::atomic_ref(*cqTail_).load(std::memory_order_acquire);
+
+    std::size_t count{};
+    for (; head != tail && count < maxCompletions; ++head, ++count)
+    {
+        const auto& cqe = cqes_[head & cqMask_]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        completions[count] = {cqe.user_data, cqe.res}; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    std::atomic_ref(*cqHead_).store(head, std::memory_order_release);
+
+    return count;
+}
+
+io_uring_sqe* IoUring::getSqe()
+{
+    auto head = std::atomic_ref(*sqHead_).load(std::memory_order_acquire);
+    if (sqLocalTail_ - head >= sqEntries_)
+        return nullptr;
+
+    auto index = sqLocalTail_ & sqMask_;
+    auto* sqe = &sqes_[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqArray_[index] = index; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    ++sqLocalTail_;
+
+    return sqe;
+}
+
+} // namespace sdbus::internal
+
+#else // SDBUSCPP_IO_URING
+
+namespace sdbus::internal {
+
+IoUring::IoUring(unsigned int /*entries*/)
+{
+    SDBUS_THROW_ERROR("sdbus-c++ has been built without io_uring support", ENOTSUP);
+}
+
+IoUring::~IoUring() = default;
+
+bool IoUring::queuePoll(int /*fd*/, short int /*events*/, uint64_t /*userData*/)
+{
+    return false;
+}
+
+bool IoUring::queuePollRemoval(uint64_t /*pollUserData*/, uint64_t /*userData*/)
+{
+    return false;
+}
+
+void IoUring::submitAndWait(std::chrono::microseconds /*timeout*/)
+{
+}
+
+std::size_t IoUring::reapCompletions(Completion* /*completions*/, std::size_t /*maxCompletions*/)
+{
+    return 0;
+}
+
+io_uring_sqe* IoUring::getSqe()
+{
+    return nullptr;
+}
+
+} // namespace sdbus::internal
+
+#endif // SDBUSCPP_IO_URING
@@ -0,0 +1,96 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file IoUring.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_IOURING_H_
+#define SDBUS_CXX_INTERNAL_IOURING_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Forward declarations
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace sdbus::internal {
+
+    // Minimal io_uring instance, used by the internal event loop to submit readiness polls
+    // and wait for their completions in a single system call. The constructor throws
+    // sdbus::Error if io_uring is not available, either because sdbus-c++ has been built
+    // without SDBUSCPP_ENABLE_IO_URING, or because the kernel doesn't support or allow it.
+    class IoUring
+    {
+    public:
+        struct Completion
+        {
+            uint64_t userData;
+            int32_t result;
+        };
+
+        explicit IoUring(unsigned int entries);
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+        IoUring(IoUring&&) = delete;
+        IoUring& operator=(IoUring&&) = delete;
+        ~IoUring();
+
+        // Queue a one-shot poll of the fd for the given poll(2) events. Returns false if the submission queue is full.
+        bool queuePoll(int fd, short int events, uint64_t userData);
+        // Queue a removal of the poll identified by its user data. Returns false if the submission queue is full.
+        bool queuePollRemoval(uint64_t pollUserData, uint64_t userData);
+        // Submits queued requests and waits for at least one completion, up to the given relative timeout.
+        // Zero timeout means no waiting, max timeout means waiting indefinitely.
+        void submitAndWait(std::chrono::microseconds timeout);
+        // Moves up to maxCompletions available completions to the given array, returns their number
+        std::size_t reapCompletions(Completion* completions, std::size_t maxCompletions);
+
+    private:
+        io_uring_sqe* getSqe();
+        void release() noexcept;
+
+        int fd_{-1};
+        unsigned int features_{};
+        void* sqRing_{};
+        std::size_t sqRingSize_{};
+        void* cqRing_{};
+        std::size_t cqRingSize_{};
+        io_uring_sqe* sqes_{};
+        std::size_t sqesSize_{};
+        unsigned int* sqHead_{};
+        unsigned int* sqTail_{};
+        unsigned int* sqArray_{};
+        unsigned int sqMask_{};
+        unsigned int sqEntries_{};
+        unsigned int sqLocalTail_{}; // Tail including queued, not yet submitted requests
+        unsigned int* cqHead_{};
+        unsigned int* cqTail_{};
+        io_uring_cqe* cqes_{};
+        unsigned int cqMask_{};
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_IOURING_H_ */
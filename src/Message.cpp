@@ -33,22 +33,138 @@
 #include "IConnection.h"
 #include "MessageUtils.h"
 #include "ScopeGuard.h"
+#include "Tracepoints.h"
+#include "Utils.h"
 
+#include <atomic>
 #include <cassert>
 #include <cerrno>
 #include <cstdint> // int16_t, uint64_t, ...
 #include <cstdio>
-#include <cstdlib> // atexit
+#include <cstdlib> // free
 #include <cstring>
+#include <limits>
+#include <mutex>
+#include <new> // std::nothrow
 #include <string>
 #include <string_view>
 #include <sys/types.h> // pid_t, gid_t, ...
-#include <tuple> // std::ignore
 #include <memory> // std::unique_ptr
 #include <utility> // std::move
 #include <vector>
 #include SDBUS_HEADER
 
+namespace sdbus::internal {
+
+// Reference count shared by all copies of a Message. The copies together hold just one reference to the underlying
+// sd-bus message, so copying and destroying them doesn't go through the connection (and its sd-bus mutex) at all,
+// except for the first reference and the last release.
+struct MessageRefCount
+{
+    std::atomic<std::size_t> count{1};
+    MessageRefCount* next{}; // Link in the free list of RefCountPool
+};
+
+// Per-thread free list of reference counts, so that wrapping an sd-bus message normally allocates nothing. A count
+// released in another thread joins the free list of that thread. The free list state is trivially destructible, so
+// messages released late during thread exit still find it valid; the guard frees the cached counts at thread exit.
+class RefCountPool
+{
+public:
+    // Returns nullptr when out of memory
+    static MessageRefCount* acquire() noexcept
+    {
+        auto& freeList = threadFreeList();
+        if (freeList.head == nullptr)
+            return new (std::nothrow) MessageRefCount; // NOLINT(cppcoreguidelines-owning-memory)
+
+        auto* refCount = freeList.head;
+        freeList.head = refCount->next;
+        --freeList.size;
+        refCount->count.store(1, std::memory_order_relaxed);
+        refCount->next = nullptr;
+        return refCount;
+    }
+
+    static void release(MessageRefCount* refCount) noexcept
+    {
+        auto& freeList = threadFreeList();
+        if (freeList.closed || freeList.size >= kMaxFreeListSize)
+        {
+            delete refCount; // NOLINT(cppcoreguidelines-owning-memory)
+            return;
+        }
+
+        refCount->next = freeList.head;
+        freeList.head = refCount;
+        ++freeList.size;
+    }
+
+private:
+    static constexpr std::size_t kMaxFreeListSize{256};
+
+    struct FreeList
+    {
+        MessageRefCount* head;
+        std::size_t size;
+        bool closed;
+    };
+
+    struct FreeListGuard
+    {
+        FreeListGuard(const FreeListGuard&) = delete;
+        FreeListGuard& operator=(const FreeListGuard&) = delete;
+        FreeListGuard(FreeListGuard&&) = delete;
+        FreeListGuard& operator=(FreeListGuard&&) = delete;
+
+        explicit FreeListGuard(FreeList& freeList) : freeList_(freeList) {}
+        ~FreeListGuard()
+        {
+            freeList_.closed = true;
+            while (freeList_.head != nullptr)
+                delete std::exchange(freeList_.head, freeList_.head->next); // NOLINT(cppcoreguidelines-owning-memory)
+            freeList_.size = 0;
+        }
+
+        FreeList& freeList_;
+    };
+
+    static FreeList& threadFreeList() noexcept
+    {
+        static thread_local FreeList freeList{};
+        static thread_local const FreeListGuard guard{freeList};
+        (void)guard;
+        return freeList;
+    }
+};
+
+// Trampoline from the sd-bus reply callback to an AsyncReplyReceiver
+struct AsyncReplyDispatcher
+{
+    static int sdbus_async_reply_handler(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
+    {
+        auto* receiver = static_cast<AsyncReplyReceiver*>(userData);
+        assert(receiver != nullptr);
+
+        receiver->connection_->recordDispatchStart(sdbusMessage);
+        SDBUS_TRACEPOINT(async_reply_matched, traceReplyCookie(sdbusMessage), sd_bus_message_get_error(sdbusMessage) != nullptr);
+        auto reply = Message::Factory::create<MethodReply>(sdbusMessage, receiver->connection_);
+
+        auto ok = invokeHandlerAndCatchErrors([&]
+        {
+            const auto* error = sd_bus_message_get_error(sdbusMessage);
+            if (error == nullptr)
+                receiver->onReply(std::move(reply), {});
+            else
+                receiver->onReply(std::move(reply), Error(Error::Name{error->name}, error->message));
+        }, retError);
+
+        return ok ? 0 : -1;
+    }
+};
+
+} // namespace sdbus::internal
+
 namespace sdbus {
 
 Message::Message(internal::IConnection* connection) noexcept
@@ -60,6 +176,7 @@ Message::Message(internal::IConnection* connection) noexcept
 Message::Message(void *msg, internal::IConnection* connection) noexcept
     : msg_(msg)
     , connection_(connection)
+    , refCount_(internal::RefCountPool::acquire())
 {
     assert(msg_ != nullptr);
     assert(connection_ != nullptr);
@@ -69,6 +186,7 @@ Message::Message(void *msg, internal::IConnection* connection) noexcept
 Message::Message(void *msg, internal::IConnection* connection, adopt_message_t) noexcept
     : msg_(msg)
     , connection_(connection)
+    , refCount_(internal::RefCountPool::acquire())
 {
     assert(msg_ != nullptr);
     assert(connection_ != nullptr);
@@ -84,14 +202,17 @@ Message& Message::operator=(const Message& other) noexcept
     if (this == &other)
         return *this;
 
-    if (msg_)
-        connection_->decrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
+    release();
 
     msg_ = other.msg_;
     connection_ = other.connection_;
     ok_ = other.ok_;
+    refCount_ = other.refCount_;
 
-    connection_->incrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
+    if (refCount_ != nullptr)
+        refCount_->count.fetch_add(1, std::memory_order_relaxed);
+    else if (msg_ != nullptr) // No shared count could be allocated, so each copy holds its own sd-bus reference
+        connection_->incrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
 
     return *this;
 }
@@ -103,8 +224,10 @@ Message::Message(Message&& other) noexcept
 
 Message& Message::operator=(Message&& other) noexcept
 {
-    if (msg_)
-        connection_->decrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
+    if (this == &other)
+        return *this;
+
+    release();
 
     msg_ = other.msg_;
     other.msg_ = nullptr;
@@ -112,14 +235,34 @@ Message& Message::operator=(Message&& other) noexcept
     other.connection_ = nullptr;
     ok_ = other.ok_;
     other.ok_ = true;
+    refCount_ = other.refCount_;
+    other.refCount_ = nullptr;
 
     return *this;
 }
 
 Message::~Message()
 {
-    if (msg_)
+    release();
+}
+
+void Message::release() noexcept
+{
+    if (msg_ == nullptr)
+        return;
+
+    // The last copy gone gives the sd-bus message reference back. Acquire-release ordering makes all
+    // accesses to the message through the other copies happen before the sd-bus message is unreferenced.
+    if (refCount_ == nullptr)
+        connection_->decrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
+    else if (refCount_->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        internal::RefCountPool::release(refCount_);
         connection_->decrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
+    }
+
+    msg_ = nullptr;
+    refCount_ = nullptr;
 }
 
 Message& Message::operator<<(bool item)
@@ -259,6 +402,23 @@ Message& Message::operator<<(const UnixFd &item)
     return *this;
 }
 
+Message& Message::operator<<(const SharedBuffer &item)
+{
+    if (item.isShared())
+    {
+        openVariant("h");
+        (*this) << item.getFd();
+    }
+    else
+    {
+        openVariant("ay");
+        appendArray(SD_BUS_TYPE_BYTE, item.data(), item.size());
+    }
+    closeVariant();
+
+    return *this;
+}
+
 Message& Message::appendArray(char type, const void *ptr, size_t size)
 {
     auto r = sd_bus_message_append_array(static_cast<sd_bus_message*>(msg_), type, ptr, size);
@@ -402,6 +562,17 @@ Message& Message::operator>>(std::string& item)
     return *this;
 }
 
+Message& Message::operator>>(std::string_view& item)
+{
+    char* str{};
+    (*this) >> str;
+
+    if (str != nullptr)
+        item = str;
+
+    return *this;
+}
+
 Message& Message::operator>>(Variant &item)
 {
     item.deserializeFrom(*this);
@@ -459,6 +630,36 @@ Message& Message::operator>>(UnixFd &item)
     return *this;
 }
 
+Message& Message::operator>>(SharedBuffer &item)
+{
+    auto [type, contents] = peekType();
+    if (type == '\0')
+    {
+        ok_ = false; // At the end of a container
+        return *this;
+    }
+
+    if (type == SD_BUS_TYPE_VARIANT && std::strcmp(contents, "h") == 0)
+    {
+        UnixFd fd;
+        enterVariant("h");
+        (*this) >> fd;
+        exitVariant();
+        item = SharedBuffer{std::move(fd)};
+    }
+    else
+    {
+        const void* ptr{};
+        size_t size{};
+        enterVariant("ay");
+        readArray(SD_BUS_TYPE_BYTE, &ptr, &size);
+        exitVariant();
+        item = SharedBuffer{ptr, size, std::numeric_limits<std::size_t>::max()};
+    }
+
+    return *this;
+}
+
 Message& Message::openContainer(const char* signature)
 {
     auto r = sd_bus_message_open_container(static_cast<sd_bus_message*>(msg_), SD_BUS_TYPE_ARRAY, signature);
@@ -867,6 +1068,13 @@ Slot MethodCall::send(void* callback, void* userData, uint64_t timeout, return_s
     return connection_->callMethodAsync(static_cast<sd_bus_message*>(msg_), reinterpret_cast<sd_bus_message_handler_t>(callback), userData, timeout, return_slot);
 }
 
+Slot MethodCall::send(AsyncReplyReceiver& receiver, uint64_t timeout, return_slot_t) const
+{
+    receiver.connection_ = connection_;
+
+    return connection_->callMethodAsync(static_cast<sd_bus_message*>(msg_), &internal::AsyncReplyDispatcher::sdbus_async_reply_handler, &receiver, timeout, return_slot);
+}
+
 MethodReply MethodCall::createReply() const
 {
     auto* sdbusReply = connection_->createMethodReply(static_cast<sd_bus_message*>(msg_));
@@ -883,6 +1091,7 @@ MethodReply MethodCall::createErrorReply(const Error& error) const
 
 void MethodReply::send() const
 {
+    SDBUS_TRACEPOINT(reply_sent, internal::traceReplyCookie(static_cast<sd_bus_message*>(msg_)), sd_bus_message_get_error(static_cast<sd_bus_message*>(msg_)) != nullptr);
     connection_->sendMessage(static_cast<sd_bus_message*>(msg_));
 }
 
@@ -899,6 +1108,11 @@ void Signal::send() const
     connection_->sendMessage(static_cast<sd_bus_message*>(msg_));
 }
 
+bool Signal::trySend() const
+{
+    return connection_->trySendMessage(static_cast<sd_bus_message*>(msg_));
+}
+
 void Signal::setDestination(const std::string& destination)
 {
     setDestination(destination.c_str());
@@ -912,47 +1126,82 @@ void Signal::setDestination(const char* destination)
 
 namespace {
 
-// Pseudo-connection lifetime handling. In standard cases, we could do with simply function-local static pseudo
-// connection instance below. However, it may happen that client's sdbus-c++ objects outlive this static connection
-// instance (because they are used in global application objects that were created before this connection, and thus
-// are destroyed later). This by itself sounds like a smell in client's application design, but it is downright bad
-// in sdbus-c++ because it has no control over when client's dependent statics get destroyed. A "Phoenix" pattern
-// (see Modern C++ Design - Generic Programming and Design Patterns Applied, by Andrei Alexandrescu) is applied to fix
-// this by re-creating the connection again in such cases and keeping it alive until the next exit handler is invoked.
-// Please note that the solution is NOT thread-safe.
-// Another common solution is global sdbus-c++ startup/shutdown functions, but that would be an intrusive change.
+// Pseudo-connection lifetime handling. Each thread constructs its local messages on a pseudo connection of its own,
+// so that the threads don't contend for a single bus lock. Messages may however outlive the thread that created them,
+// and client's sdbus-c++ objects may outlive any static connection instance (when they are used in global application
+// objects that are destroyed late), and sdbus-c++ has no control over when they get destroyed. Therefore, pseudo
+// connections are never destroyed. A connection of an exited thread is handed over to the next thread that needs one
+// instead, so the number of pseudo connections is bounded by the maximum number of threads that have used them at once.
+// A pseudo connection opens no fds and runs no event loop, so the per-thread cost is one unstarted sd_bus object plus
+// the Connection object itself (about 1.2 KiB), kept alive for the rest of the process.
+
+class PseudoConnectionPool
+{
+public:
+    internal::IConnection* acquire()
+    {
+        std::lock_guard lock(mutex_);
+        if (freeConnections_.empty())
+            return internal::createPseudoConnection().release();
+
+        auto* connection = freeConnections_.back();
+        freeConnections_.pop_back();
+        return connection;
+    }
+
+    void release(internal::IConnection* connection)
+    {
+        std::lock_guard lock(mutex_);
+        freeConnections_.push_back(connection);
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<internal::IConnection*> freeConnections_;
+};
+
+PseudoConnectionPool& getPseudoConnectionPool()
+{
+    static auto* pool = new PseudoConnectionPool; // NOLINT(cppcoreguidelines-owning-memory): Never destroyed, see above
+    return *pool;
+}
 
 #ifdef __cpp_constinit
-constinit bool pseudoConnectionDestroyed{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+constinit thread_local internal::IConnection* threadPseudoConnection{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+constinit thread_local bool threadPseudoConnectionReleased{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 #else
-bool pseudoConnectionDestroyed{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local internal::IConnection* threadPseudoConnection{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bool threadPseudoConnectionReleased{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 #endif
 
-std::unique_ptr<internal::IConnection, void(*)(internal::IConnection*)> createPseudoConnection()
+struct PseudoConnectionReleaser
 {
-    auto deleter = [](internal::IConnection* con)
-    {
-        delete con; // NOLINT(cppcoreguidelines-owning-memory)
-        pseudoConnectionDestroyed = true;
-    };
+    PseudoConnectionReleaser() = default;
+    PseudoConnectionReleaser(const PseudoConnectionReleaser&) = delete;
+    PseudoConnectionReleaser& operator=(const PseudoConnectionReleaser&) = delete;
+    PseudoConnectionReleaser(PseudoConnectionReleaser&&) = delete;
+    PseudoConnectionReleaser& operator=(PseudoConnectionReleaser&&) = delete;
 
-    return {internal::createPseudoConnection().release(), std::move(deleter)};
-}
+    ~PseudoConnectionReleaser()
+    {
+        getPseudoConnectionPool().release(std::exchange(threadPseudoConnection, nullptr));
+        threadPseudoConnectionReleased = true;
+    }
+};
 
 internal::IConnection& getPseudoConnectionInstance()
 {
-    static auto connection = createPseudoConnection();
-
-    if (pseudoConnectionDestroyed)
+    if (threadPseudoConnection == nullptr)
     {
-        connection = createPseudoConnection(); // Phoenix rising from the ashes
-        std::ignore = atexit([](){ connection.~unique_ptr(); }); // We have to manually take care of deleting the phoenix
-        pseudoConnectionDestroyed = false;
-    }
+        threadPseudoConnection = getPseudoConnectionPool().acquire();
 
-    assert(connection != nullptr);
+        // Messages may still be created after thread-local objects of this thread have been destroyed (in destructors of
+        // static objects in the main thread, for example). The connection acquired then is simply not handed over.
+        if (!threadPseudoConnectionReleased)
+            [[maybe_unused]] thread_local PseudoConnectionReleaser releaser;
+    }
 
-    return *connection;
+    return *threadPseudoConnection;
 }
 
 } // namespace
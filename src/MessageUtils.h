@@ -57,6 +57,20 @@ namespace sdbus
         {
             return Msg{msg, connection, adopt_message};
         }
+
+        // Turns a type-erased message back into its specific type, without touching its reference count
+        template<typename Msg>
+        static Msg create(Message&& message)
+        {
+            Msg msg{};
+            static_cast<Message&>(msg) = std::move(message);
+            return msg;
+        }
+
+        static void* getHandle(const Message& message)
+        {
+            return message.msg_;
+        }
     };
 } // namespace sdbus
 
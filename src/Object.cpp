@@ -36,6 +36,9 @@
 
 #include "IConnection.h"
 #include "MessageUtils.h"
+#include "ScopeGuard.h"
+#include "ThreadPool.h"
+#include "Tracepoints.h"
 #include "Utils.h"
 #include "VTableUtils.h"
 
@@ -173,6 +176,16 @@ Message Object::getCurrentlyProcessedMessage() const
     return connection_.getCurrentlyProcessedMessage();
 }
 
+void Object::setDispatchOrdering(DispatchOrdering ordering)
+{
+    dispatchOrdering_ = ordering;
+}
+
+Object::DispatchOrdering Object::getDispatchOrdering() const
+{
+    return dispatchOrdering_;
+}
+
 Object::VTable Object::createInternalVTable(InterfaceName interfaceName, std::vector<VTableItem> vtable)
 {
     VTable internalVTable;
@@ -328,6 +341,20 @@ std::string Object::paramNamesToString(const std::vector<std::string>& paramName
     return names;
 }
 
+Strand* Object::getDispatchStrand(VTable& vtable)
+{
+    switch (dispatchOrdering_)
+    {
+        case DispatchOrdering::PerObject:
+            return &strand_;
+        case DispatchOrdering::PerInterface:
+            return &vtable.strand;
+        case DispatchOrdering::Unordered:
+        default:
+            return nullptr;
+    }
+}
+
 int Object::sdbus_method_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
 {
     auto* vtable = static_cast<VTable*>(userData);
@@ -340,11 +367,38 @@ int Object::sdbus_method_callback(sd_bus_message *sdbusMessage, void *userData,
     assert(methodItem != nullptr);
     assert(methodItem->callback);
 
+    // In parallel dispatch mode, the method handler is invoked in a worker thread
+    auto& connection = vtable->object->connection_;
+    auto dispatched = connection.dispatchToWorkerThread( sdbusMessage
+                                                       , vtable->dispatchedTasks
+                                                       , vtable->object->getDispatchStrand(*vtable)
+                                                       , [methodItem, message](){ invokeDispatchedMethodHandler(methodItem->callback, message); } );
+    if (dispatched)
+        return 1;
+
+    SDBUS_TRACEPOINT(method_dispatch_start, traceCookie(sdbusMessage), methodItem->name.c_str());
     auto ok = invokeHandlerAndCatchErrors([&](){ methodItem->callback(std::move(message)); }, retError);
+    SDBUS_TRACEPOINT(method_dispatch_end, traceCookie(sdbusMessage), methodItem->name.c_str(), ok);
 
     return ok ? 1 : -1;
 }
 
+void Object::invokeDispatchedMethodHandler(const method_callback& callback, const MethodCall& message)
+{
+    sd_bus_error sdbusError = SD_BUS_ERROR_NULL;
+    SCOPE_EXIT{ sd_bus_error_free(&sdbusError); };
+
+    // Used by tracepoints only, which compile to nothing unless enabled
+    [[maybe_unused]] auto* sdbusMessage = static_cast<sd_bus_message*>(Message::Factory::getHandle(message));
+    SDBUS_TRACEPOINT(method_dispatch_start, traceCookie(sdbusMessage), sd_bus_message_get_member(sdbusMessage));
+    auto ok = invokeHandlerAndCatchErrors([&](){ callback(message); }, &sdbusError);
+    SDBUS_TRACEPOINT(method_dispatch_end, traceCookie(sdbusMessage), sd_bus_message_get_member(sdbusMessage), ok);
+
+    // We are out of sd-bus callback context here, so we have to send the error reply ourselves
+    if (!ok && !message.doesntExpectReply())
+        message.createErrorReply(Error{Error::Name{sdbusError.name}, sdbusError.message}).send();
+}
+
 int Object::sdbus_property_get_callback( sd_bus */*bus*/
                                        , const char */*objectPath*/
                                        , const char */*interface*/
@@ -31,6 +31,8 @@
 
 #include "sdbus-c++/Types.h"
 
+#include "ThreadPool.h"
+
 #include <cassert>
 #include <functional>
 #include <list>
@@ -79,6 +81,9 @@ namespace sdbus::internal {
         [[nodiscard]] const ObjectPath& getObjectPath() const override;
         [[nodiscard]] Message getCurrentlyProcessedMessage() const override;
 
+        void setDispatchOrdering(DispatchOrdering ordering) override;
+        [[nodiscard]] DispatchOrdering getDispatchOrdering() const override;
+
     private:
         // A vtable record comprising methods, signals, properties, flags.
         // Once created, it cannot be modified. Only new vtables records can be added.
@@ -127,6 +132,13 @@ namespace sdbus::internal {
             // Back-reference to the owning object from sd-bus callback handlers
             Object* object{};
 
+            // Method handlers currently dispatched to worker threads (in parallel dispatch mode).
+            // These must finish before the callbacks above are destructed, but after the vtable
+            // is unregistered, so no new handlers can be dispatched.
+            TaskGroup dispatchedTasks;
+            // Serial queue of the vtable's method handlers, used in DispatchOrdering::PerInterface mode
+            Strand strand;
+
             // This is intentionally the last member, because it must be destructed first,
             // releasing callbacks above before the callbacks themselves are destructed.
             Slot slot;
@@ -150,7 +162,10 @@ namespace sdbus::internal {
 
         static std::string paramNamesToString(const std::vector<std::string>& paramNames);
 
+        Strand* getDispatchStrand(VTable& vtable);
+
         static int sdbus_method_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
+        static void invokeDispatchedMethodHandler(const method_callback& callback, const MethodCall& message);
         static int sdbus_property_get_callback( sd_bus *bus
                                               , const char *objectPath
                                               , const char *interface
@@ -168,6 +183,10 @@ namespace sdbus::internal {
 
         IConnection& connection_; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
         ObjectPath objectPath_;
+        DispatchOrdering dispatchOrdering_{DispatchOrdering::Unordered};
+        // Serial queue of the object's method handlers, used in DispatchOrdering::PerObject mode.
+        // Must outlive vtables, which wait for their dispatched handlers upon destruction.
+        Strand strand_;
         std::vector<Slot> vtables_;
         Slot objectManagerSlot_;
     };
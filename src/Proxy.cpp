@@ -35,6 +35,7 @@
 #include "IConnection.h"
 #include "MessageUtils.h"
 #include "ScopeGuard.h"
+#include "Tracepoints.h"
 #include "Utils.h"
 
 #include <algorithm>
@@ -135,6 +136,7 @@ PendingAsyncCall Proxy::callMethodAsync(const MethodCall& message, async_reply_h
                                                                       , .slot = {}
                                                                       , .floating = false });
 
+    asyncCallInfo->executor = ExecutorBinding{resolveCallbackExecutor({}), asyncCallInfo.get(), &Proxy::invokePostedAsyncReplyHandler};
     asyncCallInfo->slot = message.send(reinterpret_cast<void*>(&Proxy::sdbus_async_reply_handler), asyncCallInfo.get(), timeout, return_slot);
 
     auto asyncCallInfoWeakPtr = std::weak_ptr{asyncCallInfo};
@@ -153,6 +155,7 @@ Slot Proxy::callMethodAsync(const MethodCall& message, async_reply_handler async
                                                                       , .slot = {}
                                                                       , .floating = true });
 
+    asyncCallInfo->executor = ExecutorBinding{resolveCallbackExecutor({}), asyncCallInfo.get(), &Proxy::invokePostedAsyncReplyHandler};
     asyncCallInfo->slot = message.send(reinterpret_cast<void*>(&Proxy::sdbus_async_reply_handler), asyncCallInfo.get(), timeout, return_slot);
 
     return {asyncCallInfo.release(), [](void *ptr){ delete static_cast<AsyncCallInfo*>(ptr); }}; // NOLINT(cppcoreguidelines-owning-memory)
@@ -209,12 +212,49 @@ Slot Proxy::registerSignalHandler( const char* interfaceName
                                  , const char* signalName
                                  , signal_handler signalHandler
                                  , return_slot_t )
+{
+    return Proxy::registerSignalHandler(interfaceName, signalName, std::move(signalHandler), Executor{}, return_slot);
+}
+
+void Proxy::registerSignalHandler( const InterfaceName& interfaceName
+                                 , const SignalName& signalName
+                                 , signal_handler signalHandler
+                                 , Executor executor )
+{
+    Proxy::registerSignalHandler(interfaceName.c_str(), signalName.c_str(), std::move(signalHandler), executor);
+}
+
+void Proxy::registerSignalHandler( const char* interfaceName
+                                 , const char* signalName
+                                 , signal_handler signalHandler
+                                 , Executor executor )
+{
+    auto slot = Proxy::registerSignalHandler(interfaceName, signalName, std::move(signalHandler), executor, return_slot);
+
+    floatingSignalSlots_.push_back(std::move(slot));
+}
+
+Slot Proxy::registerSignalHandler( const InterfaceName& interfaceName
+                                 , const SignalName& signalName
+                                 , signal_handler signalHandler
+                                 , Executor executor
+                                 , return_slot_t )
+{
+    return Proxy::registerSignalHandler(interfaceName.c_str(), signalName.c_str(), std::move(signalHandler), executor, return_slot);
+}
+
+Slot Proxy::registerSignalHandler( const char* interfaceName
+                                 , const char* signalName
+                                 , signal_handler signalHandler
+                                 , Executor executor
+                                 , return_slot_t )
 {
     SDBUS_CHECK_INTERFACE_NAME(interfaceName);
     SDBUS_CHECK_MEMBER_NAME(signalName);
     SDBUS_THROW_ERROR_IF(!signalHandler, "Invalid signal handler provided", EINVAL);
 
-    auto signalInfo = std::make_unique<SignalInfo>(SignalInfo{std::move(signalHandler), *this, {}});
+    auto signalInfo = std::make_unique<SignalInfo>(SignalInfo{std::move(signalHandler), *this, {}, {}, {}});
+    signalInfo->executor = ExecutorBinding{resolveCallbackExecutor(executor), signalInfo.get(), &Proxy::invokePostedSignalHandler};
 
     signalInfo->slot = connection_->registerSignalHandler( destination_.c_str()
                                                          , objectPath_.c_str()
@@ -233,6 +273,28 @@ void Proxy::unregister()
     floatingSignalSlots_.clear();
 }
 
+void Proxy::setCallbackExecutor(Executor executor)
+{
+    std::lock_guard lock(callbackExecutorMutex_);
+    callbackExecutor_ = std::move(executor);
+}
+
+Executor Proxy::getCallbackExecutor() const
+{
+    std::lock_guard lock(callbackExecutorMutex_);
+    return callbackExecutor_;
+}
+
+Executor Proxy::resolveCallbackExecutor(Executor executor) const
+{
+    // The most specific executor wins: the one of the subscription, then the one of the proxy, then the one of the connection
+    if (executor)
+        return executor;
+    if (auto proxyExecutor = getCallbackExecutor())
+        return proxyExecutor;
+    return connection_->getCallbackExecutor();
+}
+
 sdbus::IConnection& Proxy::getConnection() const
 {
     return *connection_;
@@ -257,24 +319,33 @@ int Proxy::sdbus_async_reply_handler(sd_bus_message *sdbusMessage, void *userDat
 
     // We are removing the CallData item at the complete scope exit, after the callback has been invoked.
     // We can't do it earlier (before callback invocation for example), because CallBack data (slot release)
-    // is the synchronization point between callback invocation and Proxy::unregister.
+    // is the synchronization point between callback invocation and Proxy::unregister. A callback posted
+    // to an executor removes the CallData item itself, and the item may even be gone once posted.
+    bool posted{};
     SCOPE_EXIT
     {
-        proxy.floatingAsyncCallSlots_.erase(asyncCallInfo);
+        if (!posted)
+            proxy.floatingAsyncCallSlots_.erase(asyncCallInfo);
     };
 
+    proxy.connection_->recordDispatchStart(sdbusMessage);
+    SDBUS_TRACEPOINT(async_reply_matched, traceReplyCookie(sdbusMessage), sd_bus_message_get_error(sdbusMessage) != nullptr);
     auto message = Message::Factory::create<MethodReply>(sdbusMessage, proxy.connection_.get());
 
     auto ok = invokeHandlerAndCatchErrors([&]
     {
-        const auto* error = sd_bus_message_get_error(sdbusMessage);
-        if (error == nullptr)
+        std::optional<Error> exception;
+        if (const auto* error = sd_bus_message_get_error(sdbusMessage); error != nullptr)
+            exception = Error(Error::Name{error->name}, error->message);
+
+        if (asyncCallInfo->executor)
         {
-            asyncCallInfo->callback(std::move(message), {});
+            asyncCallInfo->error = std::move(exception);
+            asyncCallInfo->executor.post(std::move(message));
+            posted = true;
         }
         else
         {
-            Error exception(Error::Name{error->name}, error->message);
             asyncCallInfo->callback(std::move(message), std::move(exception));
         }
     }, retError);
@@ -282,19 +353,70 @@ int Proxy::sdbus_async_reply_handler(sd_bus_message *sdbusMessage, void *userDat
     return ok ? 0 : -1;
 }
 
+void Proxy::invokePostedAsyncReplyHandler(void* userData, Message&& message)
+{
+    auto* asyncCallInfo = static_cast<AsyncCallInfo*>(userData);
+    assert(asyncCallInfo != nullptr);
+    auto& proxy = asyncCallInfo->proxy;
+
+    SCOPE_EXIT
+    {
+        proxy.floatingAsyncCallSlots_.erase(asyncCallInfo);
+    };
+
+    asyncCallInfo->callback(Message::Factory::create<MethodReply>(std::move(message)), std::move(asyncCallInfo->error));
+}
+
 int Proxy::sdbus_signal_handler(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
 {
     auto* signalInfo = static_cast<SignalInfo*>(userData);
     assert(signalInfo != nullptr);
     assert(signalInfo->callback);
 
+    SDBUS_TRACEPOINT(signal_delivered, traceCookie(sdbusMessage), sd_bus_message_get_member(sdbusMessage));
     auto message = Message::Factory::create<Signal>(sdbusMessage, signalInfo->proxy.connection_.get());
 
+    // With an executor, the signal handler is invoked in the executor's context
+    if (signalInfo->executor)
+    {
+        auto ok = invokeHandlerAndCatchErrors([&](){ signalInfo->executor.post(std::move(message)); }, retError);
+
+        return ok ? 0 : -1;
+    }
+
+    // In parallel dispatch mode, the signal handler is invoked in a worker thread
+    auto dispatched = signalInfo->proxy.connection_->dispatchToWorkerThread( sdbusMessage
+                                                                           , signalInfo->dispatchedTasks
+                                                                           , nullptr
+                                                                           , [signalInfo, message](){ invokeDispatchedSignalHandler(signalInfo->callback, message); } );
+    if (dispatched)
+        return 0;
+
     auto ok = invokeHandlerAndCatchErrors([&](){ signalInfo->callback(std::move(message)); }, retError);
 
     return ok ? 0 : -1;
 }
 
+void Proxy::invokePostedSignalHandler(void* userData, Message&& message)
+{
+    auto* signalInfo = static_cast<SignalInfo*>(userData);
+    assert(signalInfo != nullptr);
+
+    signalInfo->callback(Message::Factory::create<Signal>(std::move(message)));
+}
+
+void Proxy::invokeDispatchedSignalHandler(const signal_handler& callback, const Signal& message)
+{
+    try
+    {
+        callback(message);
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {
+        // Same as in the event loop thread, where sd-bus just ignores signal handler errors
+    }
+}
+
 Proxy::FloatingAsyncCallSlots::~FloatingAsyncCallSlots()
 {
     clear();
@@ -29,12 +29,15 @@
 
 #include "sdbus-c++/IProxy.h"
 
+#include "ExecutorBinding.h"
 #include "IConnection.h"
 #include "sdbus-c++/Types.h"
+#include "ThreadPool.h"
 
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include SDBUS_HEADER
 #include <vector>
@@ -88,21 +91,48 @@ namespace sdbus::internal {
                                   , const char* signalName
                                   , signal_handler signalHandler
                                   , return_slot_t ) override;
+        void registerSignalHandler( const InterfaceName& interfaceName
+                                  , const SignalName& signalName
+                                  , signal_handler signalHandler
+                                  , Executor executor ) override;
+        void registerSignalHandler( const char* interfaceName
+                                  , const char* signalName
+                                  , signal_handler signalHandler
+                                  , Executor executor ) override;
+        Slot registerSignalHandler( const InterfaceName& interfaceName
+                                  , const SignalName& signalName
+                                  , signal_handler signalHandler
+                                  , Executor executor
+                                  , return_slot_t ) override;
+        Slot registerSignalHandler( const char* interfaceName
+                                  , const char* signalName
+                                  , signal_handler signalHandler
+                                  , Executor executor
+                                  , return_slot_t ) override;
         void unregister() override;
 
+        void setCallbackExecutor(Executor executor) override;
+        [[nodiscard]] Executor getCallbackExecutor() const override;
+
         [[nodiscard]] sdbus::IConnection& getConnection() const override;
         [[nodiscard]] const ObjectPath& getObjectPath() const override;
         [[nodiscard]] Message getCurrentlyProcessedMessage() const override;
 
     private:
         static int sdbus_signal_handler(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
+        static void invokeDispatchedSignalHandler(const signal_handler& callback, const Signal& message);
+        static void invokePostedSignalHandler(void* userData, Message&& message);
         static int sdbus_async_reply_handler(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
+        static void invokePostedAsyncReplyHandler(void* userData, Message&& message);
+        [[nodiscard]] Executor resolveCallbackExecutor(Executor executor) const;
 
         friend PendingAsyncCall;
 
         std::unique_ptr<IConnection, std::function<void(IConnection*)>> connection_;
         ServiceName destination_;
         ObjectPath objectPath_;
+        mutable std::mutex callbackExecutorMutex_; // The executor may be set from any thread, while subscribing on another one
+        Executor callbackExecutor_;
 
         std::vector<Slot> floatingSignalSlots_;
 
@@ -110,6 +140,8 @@ namespace sdbus::internal {
         {
             signal_handler callback;
             Proxy& proxy; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            TaskGroup dispatchedTasks; // Signal handlers currently dispatched to worker threads
+            ExecutorBinding executor; // Executor the signal handler is posted to, if any
             Slot slot;
         };
 
@@ -117,7 +149,9 @@ namespace sdbus::internal {
         {
             async_reply_handler callback;
             Proxy& proxy; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            ExecutorBinding executor{}; // Executor the reply handler is posted to, if any
             Slot slot;
+            std::optional<Error> error{}; // Error carried by the reply posted to the executor
             bool finished{false};
             bool floating;
         };
@@ -29,27 +29,54 @@
 #include "sdbus-c++/Error.h" // NOLINT(misc-include-cleaner)
 #include SDBUS_HEADER
 #include <algorithm>
+#include <cassert>
 #include <cstdint>
 #include <mutex>
 #include <sys/types.h>
+#include <thread>
 
 namespace sdbus::internal {
 
-sd_bus_message* SdBus::sd_bus_message_ref(sd_bus_message *msg)
+void ThreadAffinityGuard::lock()
+{
+#ifndef NDEBUG
+    auto self = std::this_thread::get_id();
+    std::thread::id owner{};
+    // Either nobody is in the sd-bus, or we are (re-)entering it recursively, e.g. from a callback
+    auto entered = owner_.compare_exchange_strong(owner, self, std::memory_order_acquire) || owner == self;
+    assert(entered && "Single-threaded connection used from multiple threads at once");
+    (void)entered;
+    ++depth_;
+#endif
+}
+
+void ThreadAffinityGuard::unlock()
+{
+#ifndef NDEBUG
+    assert(depth_ > 0);
+    if (--depth_ == 0)
+        owner_.store(std::thread::id{}, std::memory_order_release);
+#endif
+}
+
+template <typename Mutex>
+sd_bus_message* BasicSdBus<Mutex>::sd_bus_message_ref(sd_bus_message *msg)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_ref(msg);
 }
 
-sd_bus_message* SdBus::sd_bus_message_unref(sd_bus_message *msg)
+template <typename Mutex>
+sd_bus_message* BasicSdBus<Mutex>::sd_bus_message_unref(sd_bus_message *msg)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_unref(msg);
 }
 
-int SdBus::sd_bus_send(sd_bus *bus, sd_bus_message *msg, uint64_t *cookie)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_send(sd_bus *bus, sd_bus_message *msg, uint64_t *cookie)
 {
     const std::lock_guard lock(sdbusMutex_);
 
@@ -60,14 +87,31 @@ int SdBus::sd_bus_send(sd_bus *bus, sd_bus_message *msg, uint64_t *cookie)
     return r;
 }
 
-int SdBus::sd_bus_call(sd_bus *bus, sd_bus_message *msg, uint64_t usec, sd_bus_error *ret_error, sd_bus_message **reply)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_send_batch(sd_bus *bus, sd_bus_message *const *msgs, size_t count)
+{
+    const std::lock_guard lock(sdbusMutex_);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto r = ::sd_bus_send(bus, msgs[i], nullptr); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (r < 0)
+            return r;
+    }
+
+    return 0;
+}
+
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_call(sd_bus *bus, sd_bus_message *msg, uint64_t usec, sd_bus_error *ret_error, sd_bus_message **reply)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_call(bus, msg, usec, ret_error, reply);
 }
 
-int SdBus::sd_bus_call_async(sd_bus *bus, sd_bus_slot **slot, sd_bus_message *msg, sd_bus_message_handler_t callback, void *userdata, uint64_t usec)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_call_async(sd_bus *bus, sd_bus_slot **slot, sd_bus_message *msg, sd_bus_message_handler_t callback, void *userdata, uint64_t usec)
 {
     const std::lock_guard lock(sdbusMutex_);
 
@@ -78,42 +122,48 @@ int SdBus::sd_bus_call_async(sd_bus *bus, sd_bus_slot **slot, sd_bus_message *ms
     return r;
 }
 
-int SdBus::sd_bus_message_new(sd_bus *bus, sd_bus_message **msg, uint8_t type)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_message_new(sd_bus *bus, sd_bus_message **msg, uint8_t type)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_new(bus, msg, type);
 }
 
-int SdBus::sd_bus_message_new_method_call(sd_bus *bus, sd_bus_message **msg, const char *destination, const char *path, const char *interface, const char *member)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_message_new_method_call(sd_bus *bus, sd_bus_message **msg, const char *destination, const char *path, const char *interface, const char *member)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_new_method_call(bus, msg, destination, path, interface, member);
 }
 
-int SdBus::sd_bus_message_new_signal(sd_bus *bus, sd_bus_message **msg, const char *path, const char *interface, const char *member)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_message_new_signal(sd_bus *bus, sd_bus_message **msg, const char *path, const char *interface, const char *member)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_new_signal(bus, msg, path, interface, member);
 }
 
-int SdBus::sd_bus_message_new_method_return(sd_bus_message *call, sd_bus_message **msg)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_message_new_method_return(sd_bus_message *call, sd_bus_message **msg)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_new_method_return(call, msg);
 }
 
-int SdBus::sd_bus_message_new_method_error(sd_bus_message *call, sd_bus_message **msg, const sd_bus_error *err)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_message_new_method_error(sd_bus_message *call, sd_bus_message **msg, const sd_bus_error *err)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_new_method_error(call, msg, err);
 }
 
-int SdBus::sd_bus_set_method_call_timeout(sd_bus *bus, uint64_t usec)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_set_method_call_timeout(sd_bus *bus, uint64_t usec)
 {
 #if LIBSYSTEMD_VERSION>=240
     const std::lock_guard lock(sdbusMutex_);
@@ -126,7 +176,8 @@ int SdBus::sd_bus_set_method_call_timeout(sd_bus *bus, uint64_t usec)
 #endif
 }
 
-int SdBus::sd_bus_get_method_call_timeout(sd_bus *bus, uint64_t *ret)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_get_method_call_timeout(sd_bus *bus, uint64_t *ret)
 {
 #if LIBSYSTEMD_VERSION>=240
     const std::lock_guard lock(sdbusMutex_);
@@ -139,57 +190,66 @@ int SdBus::sd_bus_get_method_call_timeout(sd_bus *bus, uint64_t *ret)
 #endif
 }
 
-int SdBus::sd_bus_emit_properties_changed_strv(sd_bus *bus, const char *path, const char *interface, char **names)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_emit_properties_changed_strv(sd_bus *bus, const char *path, const char *interface, char **names)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_emit_properties_changed_strv(bus, path, interface, names);
 }
 
-int SdBus::sd_bus_emit_object_added(sd_bus *bus, const char *path)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_emit_object_added(sd_bus *bus, const char *path)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_emit_object_added(bus, path);
 }
 
-int SdBus::sd_bus_emit_object_removed(sd_bus *bus, const char *path)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_emit_object_removed(sd_bus *bus, const char *path)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_emit_object_removed(bus, path);
 }
 
-int SdBus::sd_bus_emit_interfaces_added_strv(sd_bus *bus, const char *path, char **interfaces)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_emit_interfaces_added_strv(sd_bus *bus, const char *path, char **interfaces)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_emit_interfaces_added_strv(bus, path, interfaces);
 }
 
-int SdBus::sd_bus_emit_interfaces_removed_strv(sd_bus *bus, const char *path, char **interfaces)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_emit_interfaces_removed_strv(sd_bus *bus, const char *path, char **interfaces)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_emit_interfaces_removed_strv(bus, path, interfaces);
 }
 
-int SdBus::sd_bus_open(sd_bus **ret)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open(sd_bus **ret)
 {
     return ::sd_bus_open(ret);
 }
 
-int SdBus::sd_bus_open_system(sd_bus **ret)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open_system(sd_bus **ret)
 {
     return ::sd_bus_open_system(ret);
 }
 
-int SdBus::sd_bus_open_user(sd_bus **ret)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open_user(sd_bus **ret)
 {
     return ::sd_bus_open_user(ret);
 }
 
-int SdBus::sd_bus_open_user_with_address(sd_bus **ret, const char* address)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open_user_with_address(sd_bus **ret, const char* address)
 {
     sd_bus* bus = nullptr;
 
@@ -221,7 +281,8 @@ int SdBus::sd_bus_open_user_with_address(sd_bus **ret, const char* address)
     return 0;
 }
 
-int SdBus::sd_bus_open_direct(sd_bus **ret, const char* address)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open_direct(sd_bus **ret, const char* address)
 {
     sd_bus* bus = nullptr;
 
@@ -242,7 +303,8 @@ int SdBus::sd_bus_open_direct(sd_bus **ret, const char* address)
     return 0;
 }
 
-int SdBus::sd_bus_open_direct(sd_bus **ret, int fd)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open_direct(sd_bus **ret, int fd)
 {
     sd_bus* bus = nullptr;
 
@@ -263,7 +325,8 @@ int SdBus::sd_bus_open_direct(sd_bus **ret, int fd)
     return 0;
 }
 
-int SdBus::sd_bus_open_server(sd_bus **ret, int fd)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open_server(sd_bus **ret, int fd)
 {
     sd_bus* bus = nullptr;
 
@@ -293,7 +356,8 @@ int SdBus::sd_bus_open_server(sd_bus **ret, int fd)
     return 0;
 }
 
-int SdBus::sd_bus_open_system_remote(sd_bus **ret, const char *host)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_open_system_remote(sd_bus **ret, const char *host)
 {
 #ifndef SDBUS_basu
     return ::sd_bus_open_system_remote(ret, host);
@@ -305,92 +369,114 @@ int SdBus::sd_bus_open_system_remote(sd_bus **ret, const char *host)
 #endif
 }
 
-int SdBus::sd_bus_request_name(sd_bus *bus, const char *name, uint64_t flags)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_request_name(sd_bus *bus, const char *name, uint64_t flags)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_request_name(bus, name, flags);
 }
 
-int SdBus::sd_bus_release_name(sd_bus *bus, const char *name)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_release_name(sd_bus *bus, const char *name)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_release_name(bus, name);
 }
 
-int SdBus::sd_bus_get_unique_name(sd_bus *bus, const char **name)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_get_unique_name(sd_bus *bus, const char **name)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_get_unique_name(bus, name);
 }
 
-int SdBus::sd_bus_add_object_vtable(sd_bus *bus, sd_bus_slot **slot, const char *path, const char *interface, const sd_bus_vtable *vtable, void *userdata)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_add_object_vtable(sd_bus *bus, sd_bus_slot **slot, const char *path, const char *interface, const sd_bus_vtable *vtable, void *userdata)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_add_object_vtable(bus, slot, path, interface,  vtable, userdata);
 }
 
-int SdBus::sd_bus_add_object_manager(sd_bus *bus, sd_bus_slot **slot, const char *path)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_add_object_manager(sd_bus *bus, sd_bus_slot **slot, const char *path)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_add_object_manager(bus, slot, path);
 }
 
-int SdBus::sd_bus_add_match(sd_bus *bus, sd_bus_slot **slot, const char *match, sd_bus_message_handler_t callback, void *userdata)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_add_match(sd_bus *bus, sd_bus_slot **slot, const char *match, sd_bus_message_handler_t callback, void *userdata)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_add_match(bus, slot, match, callback, userdata);
 }
 
-int SdBus::sd_bus_add_match_async(sd_bus *bus, sd_bus_slot **slot, const char *match, sd_bus_message_handler_t callback, sd_bus_message_handler_t install_callback, void *userdata)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_add_filter(sd_bus *bus, sd_bus_slot **slot, sd_bus_message_handler_t callback, void *userdata)
+{
+    const std::lock_guard lock(sdbusMutex_);
+
+    return ::sd_bus_add_filter(bus, slot, callback, userdata);
+}
+
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_add_match_async(sd_bus *bus, sd_bus_slot **slot, const char *match, sd_bus_message_handler_t callback, sd_bus_message_handler_t install_callback, void *userdata)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_add_match_async(bus, slot, match, callback, install_callback, userdata);
 }
 
-int SdBus::sd_bus_match_signal(sd_bus *bus, sd_bus_slot **ret, const char *sender, const char *path, const char *interface, const char *member, sd_bus_message_handler_t callback, void *userdata)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_match_signal(sd_bus *bus, sd_bus_slot **ret, const char *sender, const char *path, const char *interface, const char *member, sd_bus_message_handler_t callback, void *userdata)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_match_signal(bus, ret, sender, path, interface, member, callback, userdata);
 }
 
-sd_bus_slot* SdBus::sd_bus_slot_unref(sd_bus_slot *slot)
+template <typename Mutex>
+sd_bus_slot* BasicSdBus<Mutex>::sd_bus_slot_unref(sd_bus_slot *slot)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_slot_unref(slot);
 }
 
-int SdBus::sd_bus_new(sd_bus **ret)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_new(sd_bus **ret)
 {
     return ::sd_bus_new(ret);
 }
 
-int SdBus::sd_bus_start(sd_bus *bus)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_start(sd_bus *bus)
 {
     return ::sd_bus_start(bus);
 }
 
-int SdBus::sd_bus_process(sd_bus *bus, sd_bus_message **msg)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_process(sd_bus *bus, sd_bus_message **msg)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_process(bus, msg);
 }
 
-sd_bus_message* SdBus::sd_bus_get_current_message(sd_bus *bus)
+template <typename Mutex>
+sd_bus_message* BasicSdBus<Mutex>::sd_bus_get_current_message(sd_bus *bus)
 {
     return ::sd_bus_get_current_message(bus);
 }
 
-int SdBus::sd_bus_get_poll_data(sd_bus *bus, PollData* data)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_get_poll_data(sd_bus *bus, PollData* data)
 {
     const std::lock_guard lock(sdbusMutex_);
 
@@ -409,7 +495,8 @@ int SdBus::sd_bus_get_poll_data(sd_bus *bus, PollData* data)
     return r;
 }
 
-int SdBus::sd_bus_get_n_queued(sd_bus *bus, uint64_t *read, uint64_t* write) // NOLINT(bugprone-easily-swappable-parameters)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_get_n_queued(sd_bus *bus, uint64_t *read, uint64_t* write) // NOLINT(bugprone-easily-swappable-parameters)
 {
     const std::lock_guard lock(sdbusMutex_);
 
@@ -419,17 +506,20 @@ int SdBus::sd_bus_get_n_queued(sd_bus *bus, uint64_t *read, uint64_t* write) //
     return std::min(r1, r2);
 }
 
-int SdBus::sd_bus_flush(sd_bus *bus)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_flush(sd_bus *bus)
 {
     return ::sd_bus_flush(bus);
 }
 
-sd_bus* SdBus::sd_bus_flush_close_unref(sd_bus *bus)
+template <typename Mutex>
+sd_bus* BasicSdBus<Mutex>::sd_bus_flush_close_unref(sd_bus *bus)
 {
     return ::sd_bus_flush_close_unref(bus);
 }
 
-sd_bus* SdBus::sd_bus_close_unref(sd_bus *bus)
+template <typename Mutex>
+sd_bus* BasicSdBus<Mutex>::sd_bus_close_unref(sd_bus *bus)
 {
 #if LIBSYSTEMD_VERSION>=241
     return ::sd_bus_close_unref(bus);
@@ -439,81 +529,95 @@ sd_bus* SdBus::sd_bus_close_unref(sd_bus *bus)
 #endif
 }
 
-int SdBus::sd_bus_message_set_destination(sd_bus_message *msg, const char *destination)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_message_set_destination(sd_bus_message *msg, const char *destination)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_message_set_destination(msg, destination);
 }
 
-int SdBus::sd_bus_query_sender_creds(sd_bus_message *msg, uint64_t mask, sd_bus_creds **creds)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_query_sender_creds(sd_bus_message *msg, uint64_t mask, sd_bus_creds **creds)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_query_sender_creds(msg, mask, creds);
 }
 
-sd_bus_creds* SdBus::sd_bus_creds_ref(sd_bus_creds *creds)
+template <typename Mutex>
+sd_bus_creds* BasicSdBus<Mutex>::sd_bus_creds_ref(sd_bus_creds *creds)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_ref(creds);
 }
 
-sd_bus_creds* SdBus::sd_bus_creds_unref(sd_bus_creds *creds)
+template <typename Mutex>
+sd_bus_creds* BasicSdBus<Mutex>::sd_bus_creds_unref(sd_bus_creds *creds)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_unref(creds);
 }
 
-int SdBus::sd_bus_creds_get_pid(sd_bus_creds *creds, pid_t *pid)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_creds_get_pid(sd_bus_creds *creds, pid_t *pid)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_get_pid(creds, pid);
 }
 
-int SdBus::sd_bus_creds_get_uid(sd_bus_creds *creds, uid_t *uid)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_creds_get_uid(sd_bus_creds *creds, uid_t *uid)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_get_uid(creds, uid);
 }
 
-int SdBus::sd_bus_creds_get_euid(sd_bus_creds *creds, uid_t *euid)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_creds_get_euid(sd_bus_creds *creds, uid_t *euid)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_get_euid(creds, euid);
 }
 
-int SdBus::sd_bus_creds_get_gid(sd_bus_creds *creds, gid_t *gid)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_creds_get_gid(sd_bus_creds *creds, gid_t *gid)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_get_gid(creds, gid);
 }
 
-int SdBus::sd_bus_creds_get_egid(sd_bus_creds *creds, uid_t *egid)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_creds_get_egid(sd_bus_creds *creds, uid_t *egid)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_get_egid(creds, egid);
 }
 
-int SdBus::sd_bus_creds_get_supplementary_gids(sd_bus_creds *creds, const gid_t **gids)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_creds_get_supplementary_gids(sd_bus_creds *creds, const gid_t **gids)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_get_supplementary_gids(creds, gids);
 }
 
-int SdBus::sd_bus_creds_get_selinux_context(sd_bus_creds *creds, const char **label)
+template <typename Mutex>
+int BasicSdBus<Mutex>::sd_bus_creds_get_selinux_context(sd_bus_creds *creds, const char **label)
 {
     const std::lock_guard lock(sdbusMutex_);
 
     return ::sd_bus_creds_get_selinux_context(creds, label);
 }
 
+template class BasicSdBus<std::recursive_mutex>;
+template class BasicSdBus<ThreadAffinityGuard>;
+
 } // namespace sdbus::internal
@@ -29,17 +29,40 @@
 #define SDBUS_CXX_SDBUS_H
 
 #include "ISdBus.h"
+#include <atomic>
+#include <cstddef>
 #include <mutex>
+#include <thread>
 
 namespace sdbus::internal {
 
-class SdBus final : public ISdBus
+// Lockable that does not lock, for sd-bus instances used by a single thread only. In debug builds,
+// it asserts that the sd-bus instance is not entered by another thread while one thread is in it.
+// Passing the instance from one thread to another in between (e.g. to an event loop thread) is fine.
+class ThreadAffinityGuard
+{
+public:
+    void lock();
+    void unlock();
+
+private:
+#ifndef NDEBUG
+    std::atomic<std::thread::id> owner_{};
+    std::size_t depth_{}; // Accessed only by the owner thread
+#endif
+};
+
+// Mutex guards sd-bus calls. It is std::recursive_mutex for connections shared among threads,
+// and ThreadAffinityGuard for single-threaded connections.
+template <typename Mutex>
+class BasicSdBus final : public ISdBus
 {
 public:
     sd_bus_message* sd_bus_message_ref(sd_bus_message *msg) override;
     sd_bus_message* sd_bus_message_unref(sd_bus_message *msg) override;
 
     int sd_bus_send(sd_bus *bus, sd_bus_message *msg, uint64_t *cookie) override;
+    int sd_bus_send_batch(sd_bus *bus, sd_bus_message *const *msgs, size_t count) override;
     int sd_bus_call(sd_bus *bus, sd_bus_message *msg, uint64_t usec, sd_bus_error *ret_error, sd_bus_message **reply) override;
     int sd_bus_call_async(sd_bus *bus, sd_bus_slot **slot, sd_bus_message *msg, sd_bus_message_handler_t callback, void *userdata, uint64_t usec) override;
 
@@ -72,6 +95,7 @@ public:
     int sd_bus_add_object_vtable(sd_bus *bus, sd_bus_slot **slot, const char *path, const char *interface, const sd_bus_vtable *vtable, void *userdata) override;
     int sd_bus_add_object_manager(sd_bus *bus, sd_bus_slot **slot, const char *path) override;
     int sd_bus_add_match(sd_bus *bus, sd_bus_slot **slot, const char *match, sd_bus_message_handler_t callback, void *userdata) override;
+    int sd_bus_add_filter(sd_bus *bus, sd_bus_slot **slot, sd_bus_message_handler_t callback, void *userdata) override;
     int sd_bus_add_match_async(sd_bus *bus, sd_bus_slot **slot, const char *match, sd_bus_message_handler_t callback, sd_bus_message_handler_t install_callback, void *userdata) override;
     int sd_bus_match_signal(sd_bus *bus, sd_bus_slot **ret, const char *sender, const char *path, const char *interface, const char *member, sd_bus_message_handler_t callback, void *userdata) override;
     sd_bus_slot* sd_bus_slot_unref(sd_bus_slot *slot) override;
@@ -102,9 +126,12 @@ public:
     int sd_bus_creds_get_selinux_context(sd_bus_creds *creds, const char **label) override;
 
 private:
-    std::recursive_mutex sdbusMutex_;
+    Mutex sdbusMutex_;
 };
 
+using SdBus = BasicSdBus<std::recursive_mutex>;
+using SingleThreadedSdBus = BasicSdBus<ThreadAffinityGuard>;
+
 } // namespace sdbus::internal
 
 #endif // SDBUS_CXX_SDBUS_H
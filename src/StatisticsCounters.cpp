@@ -0,0 +1,144 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file StatisticsCounters.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatisticsCounters.h"
+
+#include <algorithm>
+#include <bit>
+#include SDBUS_HEADER
+
+namespace sdbus::internal {
+
+void StatisticsCounters::recordReceived(uint8_t messageType) noexcept
+{
+    received_.record(messageType);
+}
+
+void StatisticsCounters::recordSent(uint8_t messageType) noexcept
+{
+    sent_.record(messageType);
+}
+
+void StatisticsCounters::recordPollWakeup() noexcept
+{
+    pollWakeups_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void StatisticsCounters::recordSpuriousWakeup() noexcept
+{
+    spuriousWakeups_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void StatisticsCounters::recordDispatch(std::chrono::nanoseconds latency, std::chrono::nanoseconds duration) noexcept
+{
+    record(dispatchLatency_, latency);
+    record(handlerDuration_, duration);
+    handlerTimeNs_.fetch_add(static_cast<uint64_t>(std::max(duration.count(), std::chrono::nanoseconds::rep{0})), std::memory_order_relaxed);
+}
+
+void StatisticsCounters::recordQueueLengths(uint64_t readQueueLength, uint64_t writeQueueLength) noexcept
+{
+    raise(maxReadQueueLength_, readQueueLength);
+    raise(maxWriteQueueLength_, writeQueueLength);
+}
+
+StatisticsCounters::Snapshot StatisticsCounters::snapshot() const noexcept
+{
+    Snapshot result{};
+
+    result.received = received_.snapshot();
+    result.sent = sent_.snapshot();
+    result.pollWakeups = pollWakeups_.load(std::memory_order_relaxed);
+    result.spuriousWakeups = spuriousWakeups_.load(std::memory_order_relaxed);
+    result.handlerTime = std::chrono::nanoseconds{handlerTimeNs_.load(std::memory_order_relaxed)};
+    result.maxReadQueueLength = maxReadQueueLength_.load(std::memory_order_relaxed);
+    result.maxWriteQueueLength = maxWriteQueueLength_.load(std::memory_order_relaxed);
+    result.dispatchLatency = snapshot(dispatchLatency_);
+    result.handlerDuration = snapshot(handlerDuration_);
+
+    return result;
+}
+
+std::size_t StatisticsCounters::histogramBucket(std::chrono::nanoseconds duration) noexcept
+{
+    constexpr std::size_t lastBucket = std::tuple_size_v<Snapshot::Histogram> - 1;
+
+    auto micros = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    if (micros <= 0)
+        return 0;
+
+    return std::min<std::size_t>(std::bit_width(static_cast<uint64_t>(micros)), lastBucket);
+}
+
+void StatisticsCounters::MessageCounters::record(uint8_t messageType) noexcept
+{
+    switch (messageType)
+    {
+        case SD_BUS_MESSAGE_METHOD_CALL:
+            methodCalls.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case SD_BUS_MESSAGE_METHOD_RETURN:
+            methodReplies.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case SD_BUS_MESSAGE_METHOD_ERROR:
+            methodErrors.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case SD_BUS_MESSAGE_SIGNAL:
+            signals.fetch_add(1, std::memory_order_relaxed);
+            break;
+        default:
+            break;
+    }
+}
+
+StatisticsCounters::Snapshot::MessageCounts StatisticsCounters::MessageCounters::snapshot() const noexcept
+{
+    return { methodCalls.load(std::memory_order_relaxed)
+           , methodReplies.load(std::memory_order_relaxed)
+           , methodErrors.load(std::memory_order_relaxed)
+           , signals.load(std::memory_order_relaxed) };
+}
+
+void StatisticsCounters::record(Histogram& histogram, std::chrono::nanoseconds duration) noexcept
+{
+    histogram[histogramBucket(duration)].fetch_add(1, std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+StatisticsCounters::Snapshot::Histogram StatisticsCounters::snapshot(const Histogram& histogram) noexcept
+{
+    Snapshot::Histogram result{};
+    std::transform(histogram.begin(), histogram.end(), result.begin(), [](const auto& bucket){ return bucket.load(std::memory_order_relaxed); });
+    return result;
+}
+
+void StatisticsCounters::raise(std::atomic<uint64_t>& maximum, uint64_t value) noexcept
+{
+    auto current = maximum.load(std::memory_order_relaxed);
+    while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        ;
+}
+
+} // namespace sdbus::internal
@@ -0,0 +1,88 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file StatisticsCounters.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_STATISTICSCOUNTERS_H_
+#define SDBUS_CXX_INTERNAL_STATISTICSCOUNTERS_H_
+
+#include "sdbus-c++/IConnection.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace sdbus::internal {
+
+    // Statistics counters of a connection. They are updated with relaxed atomics, so they cost
+    // next to nothing on the hot path, and they can be read by any thread at any time.
+    class StatisticsCounters
+    {
+    public:
+        using Snapshot = sdbus::IConnection::Statistics;
+
+        void recordReceived(uint8_t messageType) noexcept;
+        void recordSent(uint8_t messageType) noexcept;
+        void recordPollWakeup() noexcept;
+        void recordSpuriousWakeup() noexcept;
+        void recordDispatch(std::chrono::nanoseconds latency, std::chrono::nanoseconds duration) noexcept;
+        void recordQueueLengths(uint64_t readQueueLength, uint64_t writeQueueLength) noexcept;
+        [[nodiscard]] Snapshot snapshot() const noexcept;
+
+        // Index of the log-scale histogram bucket the duration falls into, see IConnection::Statistics::Histogram
+        [[nodiscard]] static std::size_t histogramBucket(std::chrono::nanoseconds duration) noexcept;
+
+    private:
+        struct MessageCounters
+        {
+            std::atomic<uint64_t> methodCalls;
+            std::atomic<uint64_t> methodReplies;
+            std::atomic<uint64_t> methodErrors;
+            std::atomic<uint64_t> signals;
+
+            void record(uint8_t messageType) noexcept;
+            [[nodiscard]] Snapshot::MessageCounts snapshot() const noexcept;
+        };
+
+        using Histogram = std::array<std::atomic<uint64_t>, std::tuple_size_v<Snapshot::Histogram>>;
+        static void record(Histogram& histogram, std::chrono::nanoseconds duration) noexcept;
+        static Snapshot::Histogram snapshot(const Histogram& histogram) noexcept;
+        static void raise(std::atomic<uint64_t>& maximum, uint64_t value) noexcept;
+
+        MessageCounters received_{};
+        MessageCounters sent_{};
+        std::atomic<uint64_t> pollWakeups_{};
+        std::atomic<uint64_t> spuriousWakeups_{};
+        std::atomic<uint64_t> handlerTimeNs_{};
+        std::atomic<uint64_t> maxReadQueueLength_{};
+        std::atomic<uint64_t> maxWriteQueueLength_{};
+        Histogram dispatchLatency_{};
+        Histogram handlerDuration_{};
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_STATISTICSCOUNTERS_H_ */
@@ -0,0 +1,249 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file ThreadPool.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ThreadPool.h"
+
+#include "sdbus-c++/Error.h"
+
+#include <cassert>
+#include <cerrno>
+#include <utility>
+
+namespace sdbus::internal {
+
+namespace {
+
+// Identification of the worker thread we are running in, if any
+thread_local const ThreadPool* currentPool{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::size_t currentQueue{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    SDBUS_THROW_ERROR_IF(threadCount == 0, "Invalid number of thread pool threads", EINVAL);
+
+    queues_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        queues_.push_back(std::make_unique<WorkQueue>());
+
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        workers_.emplace_back([this, i](){ run(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard lock(sleepMutex_);
+        stopping_ = true;
+    }
+    sleepCond_.notify_all();
+
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void ThreadPool::post(Task task)
+{
+    assert(task);
+
+    auto index = currentPool == this ? currentQueue : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+    {
+        auto& queue = *queues_[index];
+        const std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // The increment of queued tasks and the check for idle workers pairs with the opposite sequence in run(),
+    // so either we see a worker going to sleep and wake it up, or the worker sees the new task and doesn't sleep.
+    queuedTasks_.fetch_add(1);
+    if (idleWorkers_.load() > 0)
+    {
+        { const std::lock_guard lock(sleepMutex_); }
+        sleepCond_.notify_one();
+    }
+}
+
+std::size_t ThreadPool::size() const
+{
+    return workers_.size();
+}
+
+void ThreadPool::run(std::size_t index)
+{
+    currentPool = this;
+    currentQueue = index;
+
+    while (true)
+    {
+        Task task;
+        if (tryPop(index, task) || trySteal(index, task))
+        {
+            try
+            {
+                task();
+            }
+            catch (...) // NOLINT(bugprone-empty-catch)
+            {
+                // Tasks are expected to handle their errors themselves. Here we just keep the worker alive.
+            }
+            continue;
+        }
+
+        idleWorkers_.fetch_add(1);
+        std::unique_lock lock(sleepMutex_);
+        sleepCond_.wait(lock, [this](){ return queuedTasks_.load() > 0 || stopping_; });
+        idleWorkers_.fetch_sub(1);
+        if (stopping_ && queuedTasks_.load() == 0)
+            break;
+    }
+}
+
+bool ThreadPool::tryPop(std::size_t index, Task& task)
+{
+    auto& queue = *queues_[index];
+    const std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+
+    // The owner takes tasks from the front, to keep the order of tasks as much as possible
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    queuedTasks_.fetch_sub(1);
+    return true;
+}
+
+bool ThreadPool::trySteal(std::size_t index, Task& task)
+{
+    for (std::size_t i = 1; i < queues_.size(); ++i)
+    {
+        auto& queue = *queues_[(index + i) % queues_.size()];
+        const std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty())
+            continue;
+
+        // Thieves take tasks from the back, not to contend with the owner
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        queuedTasks_.fetch_sub(1);
+        return true;
+    }
+
+    return false;
+}
+
+TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+void TaskGroup::post(ThreadPool& pool, ThreadPool::Task task)
+{
+    pool.post(track(std::move(task)));
+}
+
+ThreadPool::Task TaskGroup::track(ThreadPool::Task task)
+{
+    {
+        const std::lock_guard lock(state_->mutex);
+        ++state_->pendingTasks;
+    }
+
+    // The state is shared with the task, so the task may safely signal its completion even after the group is gone
+    return [state = state_, task = std::move(task)]()
+    {
+        try
+        {
+            task();
+        }
+        catch (...) // NOLINT(bugprone-empty-catch)
+        {
+            // Same as in the worker loop, but we must get to the completion signalling below
+        }
+
+        const std::lock_guard lock(state->mutex);
+        if (--state->pendingTasks == 0)
+            state->cond.notify_all();
+    };
+}
+
+void TaskGroup::wait()
+{
+    if (state_ == nullptr) // Moved-from group
+        return;
+
+    std::unique_lock lock(state_->mutex);
+    state_->cond.wait(lock, [this](){ return state_->pendingTasks == 0; });
+}
+
+void Strand::post(ThreadPool& pool, ThreadPool::Task task)
+{
+    {
+        const std::lock_guard lock(state_->mutex);
+        state_->tasks.push_back(std::move(task));
+        if (state_->scheduled)
+            return; // The strand is already in the pool, it will get to this task eventually
+        state_->scheduled = true;
+    }
+
+    pool.post([&pool, state = state_](){ runNext(pool, state); });
+}
+
+void Strand::runNext(ThreadPool& pool, const std::shared_ptr<State>& state)
+{
+    ThreadPool::Task task;
+    {
+        const std::lock_guard lock(state->mutex);
+        assert(!state->tasks.empty());
+        task = std::move(state->tasks.front());
+        state->tasks.pop_front();
+    }
+
+    try
+    {
+        task();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {
+        // Same as in the worker loop, but we must keep the strand going
+    }
+
+    {
+        const std::lock_guard lock(state->mutex);
+        if (state->tasks.empty())
+        {
+            state->scheduled = false;
+            return;
+        }
+    }
+
+    // Re-post rather than loop, so that a busy strand doesn't starve other strands in the pool
+    pool.post([&pool, state](){ runNext(pool, state); });
+}
+
+} // namespace sdbus::internal
@@ -0,0 +1,138 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file ThreadPool.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_THREADPOOL_H_
+#define SDBUS_CXX_INTERNAL_THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sdbus::internal {
+
+    // A work-stealing thread pool. Each worker thread has its own task queue. Tasks posted from
+    // outside of the pool are distributed among the queues round-robin, tasks posted from within
+    // a worker thread go to that worker's queue. An idle worker steals tasks from other queues.
+    class ThreadPool
+    {
+    public:
+        using Task = std::function<void()>;
+
+        explicit ThreadPool(std::size_t threadCount);
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ThreadPool(ThreadPool&&) = delete;
+        ThreadPool& operator=(ThreadPool&&) = delete;
+        ~ThreadPool(); // Finishes all queued tasks and joins the worker threads
+
+        void post(Task task);
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        struct WorkQueue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void run(std::size_t index);
+        bool tryPop(std::size_t index, Task& task);
+        bool trySteal(std::size_t index, Task& task);
+
+        std::vector<std::unique_ptr<WorkQueue>> queues_;
+        std::atomic<std::size_t> nextQueue_{};
+        std::atomic<std::size_t> queuedTasks_{};
+        std::atomic<std::size_t> idleWorkers_{};
+        std::mutex sleepMutex_; // Only taken when there are idle workers to wake up
+        std::condition_variable sleepCond_;
+        bool stopping_{};
+        std::vector<std::thread> workers_;
+    };
+
+    // Tracks tasks posted to a thread pool on behalf of some entity (e.g. an object vtable),
+    // so that the entity can wait for its in-flight tasks to finish before it is destroyed.
+    class TaskGroup
+    {
+    public:
+        TaskGroup() = default;
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+        TaskGroup(TaskGroup&&) = default; // Moving is only meant for a group that has no tasks posted yet
+        TaskGroup& operator=(TaskGroup&&) = delete;
+        ~TaskGroup(); // Waits for all in-flight tasks of the group
+
+        void post(ThreadPool& pool, ThreadPool::Task task);
+        [[nodiscard]] ThreadPool::Task track(ThreadPool::Task task); // Makes the group wait for the returned task
+        void wait();
+
+    private:
+        struct State
+        {
+            std::mutex mutex;
+            std::condition_variable cond;
+            std::size_t pendingTasks{};
+        };
+
+        std::shared_ptr<State> state_{std::make_shared<State>()};
+    };
+
+    // A serial queue of tasks on top of a thread pool. Tasks posted to the same strand run one at
+    // a time, in the order they were posted, while tasks of different strands run in parallel.
+    // Strands share no lock, so posting to a strand only contends with other posts to that strand.
+    class Strand
+    {
+    public:
+        Strand() = default;
+        Strand(const Strand&) = delete;
+        Strand& operator=(const Strand&) = delete;
+        Strand(Strand&&) = default; // Moving is only meant for a strand that has no tasks posted yet
+        Strand& operator=(Strand&&) = delete;
+        ~Strand() = default;
+
+        void post(ThreadPool& pool, ThreadPool::Task task);
+
+    private:
+        struct State
+        {
+            std::mutex mutex;
+            std::deque<ThreadPool::Task> tasks;
+            bool scheduled{}; // Whether the strand has a task in the thread pool
+        };
+
+        static void runNext(ThreadPool& pool, const std::shared_ptr<State>& state);
+
+        std::shared_ptr<State> state_{std::make_shared<State>()};
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_THREADPOOL_H_ */
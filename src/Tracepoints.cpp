@@ -0,0 +1,36 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Tracepoints.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Tracepoints.h"
+
+#ifdef SDBUSCPP_TRACEPOINTS
+
+#define SDBUS_DEFINE_TRACEPOINT_SEMAPHORE(name) \
+    unsigned short SDBUS_TRACEPOINT_SEMAPHORE(name) __attribute__((unused, section(".probes"), visibility("hidden"))) = 0;
+SDBUS_FOR_EACH_TRACEPOINT(SDBUS_DEFINE_TRACEPOINT_SEMAPHORE)
+
+#endif // SDBUSCPP_TRACEPOINTS
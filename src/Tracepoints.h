@@ -0,0 +1,91 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Tracepoints.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_TRACEPOINTS_H_
+#define SDBUS_CXX_INTERNAL_TRACEPOINTS_H_
+
+#include <cstdint>
+#include SDBUS_HEADER
+
+// Static (USDT) tracepoints in the lifecycle of D-Bus messages, under the `sdbus' provider, for tools like
+// bpftrace, perf or SystemTap. Each tracepoint has a semaphore, which tools increment while they are attached to it.
+// An unattached tracepoint thus costs a load and a not-taken branch, and its arguments are not evaluated. Without
+// SDBUSCPP_TRACEPOINTS, tracepoints are compiled out entirely.
+#define SDBUS_FOR_EACH_TRACEPOINT(X) \
+    X(message_created)               \
+    X(message_sent)                  \
+    X(message_received)              \
+    X(method_call_sent)              \
+    X(method_dispatch_start)         \
+    X(method_dispatch_end)           \
+    X(reply_sent)                    \
+    X(async_reply_matched)           \
+    X(signal_delivered)
+
+#ifdef SDBUSCPP_TRACEPOINTS
+#define _SDT_HAS_SEMAPHORES 1 // NOLINT(bugprone-reserved-identifier)
+#include <sys/sdt.h>
+// Semaphores live in the global namespace, since sys/sdt.h refers to them by their unmangled names
+#define SDBUS_TRACEPOINT_SEMAPHORE(name) sdbus_##name##_semaphore
+#define SDBUS_DECLARE_TRACEPOINT_SEMAPHORE(name) \
+    extern unsigned short SDBUS_TRACEPOINT_SEMAPHORE(name) __attribute__((unused, section(".probes"), visibility("hidden")));
+SDBUS_FOR_EACH_TRACEPOINT(SDBUS_DECLARE_TRACEPOINT_SEMAPHORE)
+#define SDBUS_TRACEPOINT(name, ...)                                         \
+    do {                                                                    \
+        if (__builtin_expect(SDBUS_TRACEPOINT_SEMAPHORE(name) != 0, 0))     \
+            STAP_PROBEV(sdbus, name, __VA_ARGS__);                          \
+    } while (false)
+#else
+#define SDBUS_TRACEPOINT(name, ...) do {} while (false)
+#endif
+
+namespace sdbus::internal {
+
+    // Tracepoint arguments must not throw, so these return zero or null for messages that lack the field
+    inline uint64_t traceCookie(sd_bus_message* sdbusMsg) noexcept
+    {
+        uint64_t cookie{};
+        (void)sd_bus_message_get_cookie(sdbusMsg, &cookie);
+        return cookie;
+    }
+
+    inline uint64_t traceReplyCookie(sd_bus_message* sdbusMsg) noexcept
+    {
+        uint64_t cookie{};
+        (void)sd_bus_message_get_reply_cookie(sdbusMsg, &cookie);
+        return cookie;
+    }
+
+    inline uint8_t traceType(sd_bus_message* sdbusMsg) noexcept
+    {
+        uint8_t type{};
+        (void)sd_bus_message_get_type(sdbusMsg, &type);
+        return type;
+    }
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_TRACEPOINTS_H_ */
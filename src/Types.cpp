@@ -28,33 +28,115 @@
 #include "sdbus-c++/Message.h"
 #include "sdbus-c++/Types.h"
 
+#include "MessageUtils.h"
+
 #include <cerrno>
+#include <cstring>
+#include <fcntl.h>
 #include <system_error>
 #include SDBUS_HEADER
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 namespace sdbus {
 
-Variant::Variant()
-    : msg_(createPlainMessage())
-{
-}
+namespace {
+    const char* inlineTypeSignature(char type)
+    {
+        switch (type)
+        {
+            case SD_BUS_TYPE_BOOLEAN: return "b";
+            case SD_BUS_TYPE_BYTE: return "y";
+            case SD_BUS_TYPE_INT16: return "n";
+            case SD_BUS_TYPE_UINT16: return "q";
+            case SD_BUS_TYPE_INT32: return "i";
+            case SD_BUS_TYPE_UINT32: return "u";
+            case SD_BUS_TYPE_INT64: return "x";
+            case SD_BUS_TYPE_UINT64: return "t";
+            case SD_BUS_TYPE_DOUBLE: return "d";
+            case SD_BUS_TYPE_STRING: return "s";
+            case SD_BUS_TYPE_OBJECT_PATH: return "o";
+            case SD_BUS_TYPE_SIGNATURE: return "g";
+            default: return nullptr;
+        }
+    }
+
+    bool isStringType(char type)
+    {
+        return type == SD_BUS_TYPE_STRING || type == SD_BUS_TYPE_OBJECT_PATH || type == SD_BUS_TYPE_SIGNATURE;
+    }
+
+    std::shared_ptr<uint8_t> mapSharedBuffer(int fd, std::size_t size, int protection)
+    {
+        void* ptr = ::mmap(nullptr, size, protection, MAP_SHARED, fd, 0);
+        SDBUS_THROW_ERROR_IF(ptr == MAP_FAILED, "Failed to map the memfd of a shared buffer", errno);
+
+        return {static_cast<uint8_t*>(ptr), [size](uint8_t* mapping){ ::munmap(mapping, size); }};
+    }
+} // namespace
 
 void Variant::serializeTo(Message& msg) const
 {
-    SDBUS_THROW_ERROR_IF(isEmpty(), "Empty variant is not allowed", EINVAL);
-    msg_.rewind(true);
-    msg_.copyTo(msg, true);
+    if (type_ == '\0')
+    {
+        SDBUS_THROW_ERROR_IF(isEmpty(), "Empty variant is not allowed", EINVAL);
+        msg_.rewind(true);
+        msg_.copyTo(msg, true);
+        return;
+    }
+
+    auto* sdbusMsg = static_cast<sd_bus_message*>(Message::Factory::getHandle(msg));
+    auto r = sd_bus_message_open_container(sdbusMsg, SD_BUS_TYPE_VARIANT, inlineTypeSignature(type_));
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to open a variant", -r);
+    r = sd_bus_message_append_basic(sdbusMsg, type_, isStringType(type_) ? static_cast<const void*>(string_.c_str()) : &scalar_);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to serialize a variant value", -r);
+    r = sd_bus_message_close_container(sdbusMsg);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to close a variant", -r);
 }
 
 void Variant::deserializeFrom(Message& msg)
 {
+    *this = Variant{};
+
+    auto [type, contents] = msg.peekType();
+    if (type == '\0')
+        return; // At the end of a container, which leaves the variant empty
+
+    if (type == SD_BUS_TYPE_VARIANT && contents[0] != '\0' && contents[1] == '\0' && inlineTypeSignature(contents[0]) != nullptr)
+    {
+        auto* sdbusMsg = static_cast<sd_bus_message*>(Message::Factory::getHandle(msg));
+        auto r = sd_bus_message_enter_container(sdbusMsg, SD_BUS_TYPE_VARIANT, contents);
+        SDBUS_THROW_ERROR_IF(r < 0, "Failed to enter a variant", -r);
+        if (isStringType(contents[0]))
+        {
+            const char* str{};
+            r = sd_bus_message_read_basic(sdbusMsg, contents[0], &str);
+            SDBUS_THROW_ERROR_IF(r < 0, "Failed to deserialize a variant value", -r);
+            string_ = str;
+        }
+        else
+        {
+            r = sd_bus_message_read_basic(sdbusMsg, contents[0], &scalar_);
+            SDBUS_THROW_ERROR_IF(r < 0, "Failed to deserialize a variant value", -r);
+        }
+        type_ = contents[0];
+        r = sd_bus_message_exit_container(sdbusMsg);
+        SDBUS_THROW_ERROR_IF(r < 0, "Failed to exit a variant", -r);
+        return;
+    }
+
+    msg_ = createPlainMessage();
     msg.copyTo(msg_, false);
     msg_.seal();
 }
 
 const char* Variant::peekValueType() const
 {
+    if (type_ != '\0')
+        return inlineTypeSignature(type_);
+
+    materialize();
     msg_.rewind(false);
     auto [type, contents] = msg_.peekType();
     return contents;
@@ -62,7 +144,20 @@ const char* Variant::peekValueType() const
 
 bool Variant::isEmpty() const
 {
-    return msg_.isEmpty();
+    return type_ == '\0' && (!msg_.isValid() || msg_.isEmpty());
+}
+
+void Variant::materialize() const
+{
+    if (msg_.isValid())
+        return;
+
+    msg_ = createPlainMessage();
+    if (type_ != '\0')
+    {
+        serializeTo(msg_);
+        msg_.seal();
+    }
 }
 
 void UnixFd::close() // NOLINT(readability-make-member-function-const)
@@ -88,4 +183,62 @@ int UnixFd::checkedDup(int fd)
     return ret;
 }
 
+SharedBuffer::SharedBuffer(const void* data, std::size_t size, std::size_t inlineThreshold)
+    : SharedBuffer(create(size, [data, size](void* dest){ std::memcpy(dest, data, size); }, inlineThreshold))
+{
+}
+
+SharedBuffer::SharedBuffer(UnixFd fd, std::size_t maxSize)
+{
+    // Without these seals, the peer could modify the data under our hands, or shrink the memfd and make us crash on SIGBUS
+    constexpr int requiredSeals = F_SEAL_SHRINK | F_SEAL_WRITE;
+    const int seals = ::fcntl(fd.get(), F_GET_SEALS);
+    SDBUS_THROW_ERROR_IF(seals < 0, "Failed to get seals of the memfd of a shared buffer", errno);
+    SDBUS_THROW_ERROR_IF((seals & requiredSeals) != requiredSeals, "The memfd of a shared buffer is not sealed", EPERM);
+
+    struct stat stats{};
+    auto r = ::fstat(fd.get(), &stats);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get size of the memfd of a shared buffer", errno);
+
+    SDBUS_THROW_ERROR_IF(static_cast<std::size_t>(stats.st_size) > maxSize, "The memfd of a shared buffer is too large", EMSGSIZE);
+
+    size_ = static_cast<std::size_t>(stats.st_size);
+    if (size_ > 0)
+        data_ = mapSharedBuffer(fd.get(), size_, PROT_READ);
+    fd_ = std::move(fd);
+}
+
+SharedBuffer SharedBuffer::create(std::size_t size, const std::function<void(void* data)>& writer, std::size_t inlineThreshold)
+{
+    SharedBuffer buffer;
+    buffer.size_ = size;
+
+    if (size == 0 || size < inlineThreshold)
+    {
+        if (size > 0)
+        {
+            std::shared_ptr<uint8_t[]> bytes{new uint8_t[size]};
+            writer(bytes.get());
+            buffer.data_ = std::shared_ptr<const uint8_t>{bytes, bytes.get()};
+        }
+        return buffer;
+    }
+
+    UnixFd fd{::memfd_create("sdbus-c++-shared-buffer", MFD_CLOEXEC | MFD_ALLOW_SEALING), adopt_fd};
+    SDBUS_THROW_ERROR_IF(!fd.isValid(), "Failed to create the memfd of a shared buffer", errno);
+    auto r = ::ftruncate(fd.get(), static_cast<off_t>(size));
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to resize the memfd of a shared buffer", errno);
+
+    // The writable mapping must be gone before sealing, otherwise F_SEAL_WRITE fails with EBUSY
+    writer(mapSharedBuffer(fd.get(), size, PROT_READ | PROT_WRITE).get());
+
+    r = ::fcntl(fd.get(), F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to seal the memfd of a shared buffer", errno);
+
+    buffer.data_ = mapSharedBuffer(fd.get(), size, PROT_READ);
+    buffer.fd_ = std::move(fd);
+
+    return buffer;
+}
+
 } // namespace sdbus
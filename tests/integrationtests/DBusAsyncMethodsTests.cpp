@@ -39,8 +39,10 @@
 #include <mutex>
 #include <map>
 #include <string>
+#include <tuple>
 #include <thread>
 #include <chrono>
+#include <functional>
 #include <future>
 #include <utility>
 #include <vector>
@@ -52,6 +54,30 @@ using ::testing::ElementsAre;
 using namespace std::chrono_literals;
 using namespace sdbus::test;
 
+#ifdef __cpp_lib_coroutine
+namespace {
+
+FutureCoroutine<uint32_t> doOperation(TestProxy& proxy, uint32_t param)
+{
+    co_return co_await proxy.doOperationClientSideAsync(param, sdbus::with_awaitable);
+}
+
+template <typename Executor>
+FutureCoroutine<std::thread::id> doOperationResumingOn(TestProxy& proxy, Executor& executor)
+{
+    co_await proxy.doOperationClientSideAsync(10, sdbus::with_awaitable).resumeOn(executor);
+    co_return std::this_thread::get_id();
+}
+
+FutureCoroutine<bool> doErroneousOperation(TestProxy& proxy)
+{
+    co_await proxy.doErroneousOperationClientSideAsync(sdbus::with_awaitable);
+    co_return true;
+}
+
+} // namespace
+#endif // __cpp_lib_coroutine
+
 /*-------------------------------------*/
 /* --          TEST CASES           -- */
 /*-------------------------------------*/
@@ -182,6 +208,35 @@ TYPED_TEST(AsyncSdbusTestObject, InvokesMethodAsynchronouslyOnClientSideWithFutu
     ASSERT_THAT(future.get(), Eq(100));
 }
 
+#ifdef __cpp_lib_coroutine
+TYPED_TEST(AsyncSdbusTestObject, InvokesMethodAsynchronouslyOnClientSideWithAwaitable)
+{
+    auto coroutine = doOperation(*this->m_proxy, 100);
+
+    ASSERT_THAT(coroutine.future.get(), Eq(100));
+}
+
+TYPED_TEST(AsyncSdbusTestObject, InvokesManyMethodsConcurrentlyOnClientSideWithAwaitables)
+{
+    std::vector<FutureCoroutine<uint32_t>> coroutines;
+    for (uint32_t i = 0; i < 50; ++i)
+        coroutines.push_back(doOperation(*this->m_proxy, i % 5));
+
+    for (uint32_t i = 0; i < 50; ++i)
+        ASSERT_THAT(coroutines[i].future.get(), Eq(i % 5));
+}
+
+TYPED_TEST(AsyncSdbusTestObject, ResumesAwaitingCoroutineOnGivenExecutor)
+{
+    QueueingExecutor executor;
+
+    auto coroutine = doOperationResumingOn(*this->m_proxy, executor);
+
+    ASSERT_TRUE(waitUntil([&](){ return executor.runOne(); }));
+    ASSERT_THAT(coroutine.future.get(), Eq(std::this_thread::get_id()));
+}
+#endif // __cpp_lib_coroutine
+
 TYPED_TEST(AsyncSdbusTestObject, InvokesMethodAsynchronouslyOnClientSideWithFutureOnBasicAPILevel)
 {
     auto future = this->m_proxy->doOperationClientSideAsyncOnBasicAPILevel(100);
@@ -301,3 +356,155 @@ TYPED_TEST(AsyncSdbusTestObject, ThrowsErrorWhenClientSideAsynchronousMethodCall
 
     ASSERT_THROW(future.get(), sdbus::Error);
 }
+
+#ifdef __cpp_lib_coroutine
+TYPED_TEST(AsyncSdbusTestObject, ThrowsErrorWhenClientSideAsynchronousMethodCallWithAwaitableFails)
+{
+    auto coroutine = doErroneousOperation(*this->m_proxy);
+
+    ASSERT_THROW(coroutine.future.get(), sdbus::Error);
+}
+#endif // __cpp_lib_coroutine
+
+#ifdef __cpp_lib_coroutine
+TYPED_TEST(AsyncSdbusTestObject, InvokesCoroutineMethodOnServerSide)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("multiply").implementedAs([](const int& lhs, const int& rhs) -> sdbus::Task<int>
+                                          {
+                                              co_return lhs * rhs;
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    int result{};
+    proxy->callMethod("multiply").onInterface(interfaceName).withArguments(6, 7).storeResultsTo(result);
+
+    ASSERT_THAT(result, Eq(42));
+}
+
+TYPED_TEST(AsyncSdbusTestObject, CoroutineMethodDoesNotBlockEventLoopWhileAwaitingDownstreamCall)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    // The downstream call is served by the very same event loop that runs the coroutine method,
+    // so if the suspended coroutine held the event loop thread, this would deadlock.
+    auto downstreamProxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("doOperationTwice").implementedAs([&](uint32_t param) -> sdbus::Task<std::tuple<uint32_t, uint32_t>>
+                                          {
+                                              auto first = co_await downstreamProxy->callMethodAsync("doOperation").onInterface(INTERFACE_NAME).withArguments(param).template getResultAsAwaitable<uint32_t>();
+                                              auto second = co_await downstreamProxy->callMethodAsync("doOperation").onInterface(INTERFACE_NAME).withArguments(param + 1).template getResultAsAwaitable<uint32_t>();
+                                              co_return std::tuple{first, second};
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    uint32_t first{};
+    uint32_t second{};
+    proxy->callMethod("doOperationTwice").onInterface(interfaceName).withArguments(uint32_t{10}).storeResultsTo(first, second);
+
+    ASSERT_THAT(first, Eq(10));
+    ASSERT_THAT(second, Eq(11));
+}
+
+TYPED_TEST(AsyncSdbusTestObject, ReturnsErrorReplyWhenCoroutineMethodThrows)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    auto downstreamProxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("fail").implementedAs([&]() -> sdbus::Task<>
+                                          {
+                                              co_await downstreamProxy->callMethodAsync("doOperation").onInterface(INTERFACE_NAME).withArguments(uint32_t{1}).template getResultAsAwaitable<uint32_t>();
+                                              throw sdbus::Error(sdbus::Error::Name{"org.sdbuscpp.Error.Coroutine"}, "Failed after suspension");
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    try
+    {
+        proxy->callMethod("fail").onInterface(interfaceName);
+        FAIL() << "Expected sdbus::Error exception";
+    }
+    catch (const sdbus::Error& e)
+    {
+        ASSERT_THAT(e.getName(), Eq("org.sdbuscpp.Error.Coroutine"));
+        ASSERT_THAT(e.getMessage(), Eq("Failed after suspension"));
+    }
+}
+
+TYPED_TEST(AsyncSdbusTestObject, CompletesSuspendedCoroutineMethodAfterItsVTableIsRemoved)
+{
+    // Suspends the coroutine method until the test resumes it by hand
+    struct ManualResumption
+    {
+        std::atomic<void*>& handle;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> coroutine) noexcept { handle = coroutine.address(); }
+        void await_resume() const noexcept {}
+    };
+    std::atomic<void*> suspendedMethod{};
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("greet").implementedAs([&suspendedMethod, greeting = std::string(100, 'x')]() -> sdbus::Task<std::string>
+                                          {
+                                              co_await ManualResumption{suspendedMethod};
+                                              co_return greeting; // Captured by the closure, which must still be alive here
+                                          }) }
+                                      , sdbus::return_slot );
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    auto future = proxy->callMethodAsync("greet").onInterface(interfaceName).template getResultAsFuture<std::string>();
+    ASSERT_TRUE(waitUntil([&](){ return suspendedMethod.load() != nullptr; }));
+
+    vtableSlot.reset();
+    std::coroutine_handle<>::from_address(suspendedMethod.load()).resume();
+
+    ASSERT_THAT(future.get(), Eq(std::string(100, 'x')));
+}
+#endif // __cpp_lib_coroutine
+
+TYPED_TEST(AsyncSdbusTestObject, PostsAsyncReplyHandlerToProxyExecutor)
+{
+    QueueingExecutor executor;
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    proxy->setCallbackExecutor(executor);
+    std::optional<uint32_t> result;
+    std::thread::id handlerThread;
+
+    auto slot = proxy->callMethodAsync("doOperation")
+                      .onInterface(INTERFACE_NAME)
+                      .withArguments(uint32_t{100})
+                      .uponReplyInvoke([&](std::optional<sdbus::Error> error, uint32_t returnValue)
+                                       {
+                                           if (!error)
+                                               result = returnValue;
+                                           handlerThread = std::this_thread::get_id();
+                                       }, sdbus::return_slot);
+
+    ASSERT_TRUE(waitUntil([&](){ return executor.runOne(); }));
+    ASSERT_THAT(result, Eq(100));
+    ASSERT_THAT(handlerThread, Eq(std::this_thread::get_id()));
+}
+
+TYPED_TEST(AsyncSdbusTestObject, DoesNotInvokeQueuedAsyncReplyHandlerOfCancelledCall)
+{
+    QueueingExecutor executor;
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    proxy->setCallbackExecutor(executor);
+    std::atomic<bool> invoked{false};
+
+    auto call = proxy->callMethodAsync("doOperation")
+                      .onInterface(INTERFACE_NAME)
+                      .withArguments(uint32_t{1})
+                      .uponReplyInvoke([&](std::optional<sdbus::Error> /*error*/, uint32_t /*returnValue*/){ invoked = true; });
+    ASSERT_TRUE(waitUntil([&](){ const std::lock_guard lock(executor.mutex); return !executor.queue.empty(); }));
+    call.cancel();
+
+    ASSERT_TRUE(executor.runOne());
+    ASSERT_FALSE(invoked);
+    ASSERT_FALSE(call.isPending());
+}
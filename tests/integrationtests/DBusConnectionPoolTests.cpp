@@ -0,0 +1,134 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file DBusConnectionPoolTests.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Own
+#include "Defs.h"
+
+// sdbus
+#include <sdbus-c++/ConnectionPool.h>
+#include <sdbus-c++/Error.h>
+#include <sdbus-c++/sdbus-c++.h>
+
+// gmock
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+// STL
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ::testing::Eq;
+using ::testing::Lt;
+using ::testing::SizeIs;
+using namespace std::chrono_literals;
+using namespace sdbus::test;
+
+/*-------------------------------------*/
+/* --          TEST CASES           -- */
+/*-------------------------------------*/
+
+TEST(ConnectionPool, ThrowsErrorWhenCreatedWithZeroShards)
+{
+    ASSERT_THROW(sdbus::ConnectionPool{0}, sdbus::Error);
+}
+
+TEST(ConnectionPool, OpensOneConnectionPerShard)
+{
+    sdbus::ConnectionPool pool{3};
+
+    std::set<std::string> uniqueNames;
+    for (std::size_t i = 0; i < pool.size(); ++i)
+        uniqueNames.insert(pool.getConnection(i).getUniqueName());
+
+    ASSERT_THAT(uniqueNames, SizeIs(3));
+}
+
+TEST(ConnectionPool, ThrowsErrorWhenAccessingShardOutOfRange)
+{
+    sdbus::ConnectionPool pool{2};
+
+    ASSERT_THROW((void)pool.getConnection(2), sdbus::Error);
+}
+
+TEST(ConnectionPool, RoutesObjectPathToTheSameShardConsistently)
+{
+    sdbus::ConnectionPool pool{4};
+
+    auto shard = pool.getShardFor(OBJECT_PATH);
+
+    ASSERT_THAT(shard, Lt(4));
+    ASSERT_THAT(pool.getShardFor(OBJECT_PATH), Eq(shard));
+    ASSERT_THAT(&pool.getConnectionFor(OBJECT_PATH), Eq(&pool.getConnection(shard)));
+}
+
+TEST(ConnectionPool, RoutesObjectPathsWithCustomShardingPolicy)
+{
+    auto policy = [](const sdbus::ObjectPath& objectPath, std::size_t /*shardCount*/){ return objectPath == OBJECT_PATH ? 0 : 1; };
+    sdbus::ConnectionPool pool{2, {}, policy};
+
+    ASSERT_THAT(pool.getShardFor(OBJECT_PATH), Eq(0));
+    ASSERT_THAT(pool.getShardFor(OBJECT_PATH_2), Eq(1));
+}
+
+TEST(ConnectionPool, CreatesConnectionsWithCustomFactory)
+{
+    std::size_t createdConnections{};
+    sdbus::ConnectionPool pool{2, [&](){ ++createdConnections; return sdbus::createBusConnection(sdbus::single_threaded); }};
+
+    ASSERT_THAT(createdConnections, Eq(2));
+}
+
+TEST(ConnectionPool, ServesObjectsOnAllShardsInTheirEventLoops)
+{
+    sdbus::ConnectionPool pool{2, {}, [](const sdbus::ObjectPath& objectPath, std::size_t){ return objectPath == OBJECT_PATH ? 0 : 1; }};
+    std::vector<std::unique_ptr<sdbus::IObject>> objects;
+    for (const auto& objectPath : {OBJECT_PATH, OBJECT_PATH_2})
+    {
+        auto& connection = pool.getConnectionFor(objectPath);
+        auto object = sdbus::createObject(connection, objectPath);
+        object->addVTable(sdbus::registerMethod("getThreadId").implementedAs([](){ return std::hash<std::thread::id>{}(std::this_thread::get_id()); }))
+              .forInterface(INTERFACE_NAME);
+        objects.push_back(std::move(object));
+    }
+    pool.enterEventLoopsAsync();
+
+    std::set<std::size_t> threadIds;
+    for (std::size_t i = 0; i < pool.size(); ++i)
+    {
+        auto proxy = sdbus::createLightWeightProxy(pool.getConnection(i).getUniqueName(), i == 0 ? OBJECT_PATH : OBJECT_PATH_2);
+        std::size_t threadId{};
+        proxy->callMethod("getThreadId").onInterface(INTERFACE_NAME).storeResultsTo(threadId);
+        threadIds.insert(threadId);
+    }
+    pool.leaveEventLoops();
+
+    ASSERT_THAT(threadIds, SizeIs(2));
+}
@@ -30,13 +30,35 @@
 // sdbus
 #include <sdbus-c++/Error.h>
 #include <sdbus-c++/IConnection.h>
+#include <sdbus-c++/sdbus-c++.h>
 
 // gmock
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 // STL
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
+// POSIX
+#include <poll.h>
+#include <unistd.h>
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Gt;
+using ::testing::Lt;
+using namespace std::chrono_literals;
 using namespace sdbus::test;
 
 /*-------------------------------------*/
@@ -91,3 +113,552 @@ TEST(Connection, CanEnterAndLeaveInternalEventLoop)
 
     t.join();
 }
+
+TEST(Connection, InvokesMethodHandlersConcurrentlyWhenDispatchingToWorkerThreads)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setDispatchThreadCount(2);
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    std::atomic<int> runningHandlers{0};
+    std::atomic<int> maxRunningHandlers{0};
+    object->addVTable( sdbus::registerMethod("sleep").implementedAs([&]()
+                       {
+                           auto running = ++runningHandlers;
+                           auto maxRunning = maxRunningHandlers.load();
+                           while (running > maxRunning && !maxRunningHandlers.compare_exchange_weak(maxRunning, running));
+                           std::this_thread::sleep_for(200ms);
+                           --runningHandlers;
+                       }) ).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    auto callSleep = [destination = connection->getUniqueName()]()
+    {
+        auto proxy = sdbus::createLightWeightProxy(destination, OBJECT_PATH);
+        proxy->callMethod("sleep").onInterface(INTERFACE_NAME);
+    };
+    auto call1 = std::async(std::launch::async, callSleep);
+    auto call2 = std::async(std::launch::async, callSleep);
+    call1.get();
+    call2.get();
+
+    ASSERT_THAT(connection->getDispatchThreadCount(), Eq(2));
+    ASSERT_THAT(maxRunningHandlers, Eq(2));
+}
+
+TEST(Connection, InvokesMethodHandlersOfObjectOneAtATimeInPerObjectDispatchOrdering)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setDispatchThreadCount(2);
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->setDispatchOrdering(sdbus::IObject::DispatchOrdering::PerObject);
+    std::atomic<int> runningHandlers{0};
+    std::atomic<int> maxRunningHandlers{0};
+    auto sleepHandler = [&]()
+    {
+        auto running = ++runningHandlers;
+        auto maxRunning = maxRunningHandlers.load();
+        while (running > maxRunning && !maxRunningHandlers.compare_exchange_weak(maxRunning, running));
+        std::this_thread::sleep_for(200ms);
+        --runningHandlers;
+    };
+    // Two vtables of the same object still share one strand
+    object->addVTable(sdbus::registerMethod("sleep").implementedAs(sleepHandler)).forInterface(INTERFACE_NAME);
+    object->addVTable(sdbus::registerMethod("sleep").implementedAs(sleepHandler)).forInterface("org.sdbuscpp.integrationtests2");
+    connection->enterEventLoopAsync();
+
+    auto callSleep = [destination = connection->getUniqueName()](const char* interfaceName)
+    {
+        auto proxy = sdbus::createLightWeightProxy(destination, OBJECT_PATH);
+        proxy->callMethod("sleep").onInterface(interfaceName);
+    };
+    auto call1 = std::async(std::launch::async, callSleep, INTERFACE_NAME.c_str());
+    auto call2 = std::async(std::launch::async, callSleep, "org.sdbuscpp.integrationtests2");
+    call1.get();
+    call2.get();
+
+    ASSERT_THAT(object->getDispatchOrdering(), Eq(sdbus::IObject::DispatchOrdering::PerObject));
+    ASSERT_THAT(maxRunningHandlers, Eq(1));
+}
+
+TEST(Connection, InvokesMethodHandlersOfDifferentObjectsConcurrentlyInPerObjectDispatchOrdering)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setDispatchThreadCount(2);
+    std::atomic<int> runningHandlers{0};
+    std::atomic<int> maxRunningHandlers{0};
+    auto sleepHandler = [&]()
+    {
+        auto running = ++runningHandlers;
+        auto maxRunning = maxRunningHandlers.load();
+        while (running > maxRunning && !maxRunningHandlers.compare_exchange_weak(maxRunning, running));
+        std::this_thread::sleep_for(200ms);
+        --runningHandlers;
+    };
+    auto object1 = sdbus::createObject(*connection, OBJECT_PATH);
+    object1->setDispatchOrdering(sdbus::IObject::DispatchOrdering::PerObject);
+    object1->addVTable(sdbus::registerMethod("sleep").implementedAs(sleepHandler)).forInterface(INTERFACE_NAME);
+    auto object2 = sdbus::createObject(*connection, OBJECT_PATH_2);
+    object2->setDispatchOrdering(sdbus::IObject::DispatchOrdering::PerObject);
+    object2->addVTable(sdbus::registerMethod("sleep").implementedAs(sleepHandler)).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    auto callSleep = [destination = connection->getUniqueName()](const sdbus::ObjectPath& objectPath)
+    {
+        auto proxy = sdbus::createLightWeightProxy(destination, objectPath);
+        proxy->callMethod("sleep").onInterface(INTERFACE_NAME);
+    };
+    auto call1 = std::async(std::launch::async, callSleep, OBJECT_PATH);
+    auto call2 = std::async(std::launch::async, callSleep, OBJECT_PATH_2);
+    call1.get();
+    call2.get();
+
+    ASSERT_THAT(maxRunningHandlers, Eq(2));
+}
+
+TEST(Connection, ProvidesMethodCallMessageAndRepliesWithErrorFromWorkerThread)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setDispatchThreadCount(2);
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    std::string memberName;
+    object->addVTable( sdbus::registerMethod("fail").implementedAs([&]()
+                       {
+                           memberName = object->getCurrentlyProcessedMessage().getMemberName();
+                           throw sdbus::Error(sdbus::Error::Name{"org.sdbuscpp.Error"}, "A test error");
+                       }) ).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createLightWeightProxy(connection->getUniqueName(), OBJECT_PATH);
+    try
+    {
+        proxy->callMethod("fail").onInterface(INTERFACE_NAME);
+        FAIL() << "Expected sdbus::Error exception";
+    }
+    catch (const sdbus::Error& e)
+    {
+        ASSERT_THAT(e.getName(), Eq("org.sdbuscpp.Error"));
+        ASSERT_THAT(e.getMessage(), Eq("A test error"));
+    }
+    ASSERT_THAT(memberName, Eq("fail"));
+}
+
+TEST(Connection, InvokesSignalHandlersInWorkerThreads)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable(sdbus::registerSignal("simpleSignal")).forInterface(INTERFACE_NAME);
+    auto clientConnection = sdbus::createBusConnection();
+    clientConnection->setDispatchThreadCount(1);
+    auto proxy = sdbus::createProxy(*clientConnection, serverConnection->getUniqueName(), OBJECT_PATH);
+    std::promise<std::thread::id> handlerThread;
+    proxy->uponSignal("simpleSignal").onInterface(INTERFACE_NAME).call([&](){ handlerThread.set_value(std::this_thread::get_id()); });
+    // Match rule callbacks are always invoked in the event loop thread
+    std::promise<std::thread::id> eventLoopThread;
+    auto matchRule = "type='signal',interface='" + INTERFACE_NAME + "',member='simpleSignal'";
+    clientConnection->addMatch(matchRule, [&](sdbus::Message /*msg*/){ eventLoopThread.set_value(std::this_thread::get_id()); });
+    clientConnection->enterEventLoopAsync();
+    std::this_thread::sleep_for(50ms); // Give time for the proxy connection to start listening to signals
+
+    object->emitSignal("simpleSignal").onInterface(INTERFACE_NAME);
+
+    auto handlerThreadId = handlerThread.get_future();
+    auto eventLoopThreadId = eventLoopThread.get_future();
+    ASSERT_THAT(handlerThreadId.wait_for(1s), Eq(std::future_status::ready));
+    ASSERT_THAT(eventLoopThreadId.wait_for(1s), Eq(std::future_status::ready));
+    ASSERT_NE(handlerThreadId.get(), eventLoopThreadId.get());
+}
+
+TEST(Connection, InvokesFdWatchCallbackInEventLoopWhenFdGetsReady)
+{
+    auto connection = sdbus::createBusConnection();
+    std::array<int, 2> pipeFds{};
+    ASSERT_THAT(pipe(pipeFds.data()), Eq(0));
+    std::promise<short int> receivedEvents;
+    auto watch = connection->addFdWatch(pipeFds[0], POLLIN, [&](short int revents)
+    {
+        char data{};
+        (void)read(pipeFds[0], &data, 1);
+        receivedEvents.set_value(revents);
+    }, sdbus::return_slot);
+    connection->enterEventLoopAsync();
+
+    ASSERT_THAT(write(pipeFds[1], "x", 1), Eq(1));
+
+    auto future = receivedEvents.get_future();
+    ASSERT_THAT(future.wait_for(1s), Eq(std::future_status::ready));
+    ASSERT_TRUE(future.get() & POLLIN);
+    connection->leaveEventLoop();
+    watch.reset();
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+TEST(Connection, StopsInvokingFdWatchCallbackAfterWatchSlotIsDestroyed)
+{
+    auto connection = sdbus::createBusConnection();
+    std::array<int, 2> pipeFds{};
+    ASSERT_THAT(pipe(pipeFds.data()), Eq(0));
+    std::atomic<int> callbackCount{0};
+    auto watch = connection->addFdWatch(pipeFds[0], POLLIN, [&](short int /*revents*/){ ++callbackCount; }, sdbus::return_slot);
+    watch.reset();
+    connection->enterEventLoopAsync();
+
+    ASSERT_THAT(write(pipeFds[1], "x", 1), Eq(1));
+    std::this_thread::sleep_for(50ms);
+
+    ASSERT_THAT(callbackCount, Eq(0));
+    connection->leaveEventLoop();
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+TEST(Connection, InvokesTimerCallbackPeriodicallyInEventLoop)
+{
+    auto connection = sdbus::createBusConnection();
+    std::atomic<int> expirations{0};
+    auto timer = connection->addTimer(10ms, [&](){ ++expirations; }, sdbus::return_slot);
+    connection->enterEventLoopAsync();
+
+    std::this_thread::sleep_for(100ms);
+
+    ASSERT_GE(expirations, 3);
+}
+
+TEST(Connection, ThrowsErrorWhenSettingDispatchBudgetOfZeroMessages)
+{
+    auto connection = sdbus::createBusConnection();
+
+    ASSERT_THROW(connection->setDispatchBudget({0, 1ms}), sdbus::Error);
+}
+
+TEST(Connection, ReceivesBurstOfSignalsInOrderWhenProcessingThemInBatches)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable(sdbus::registerSignal("numberSignal").withParameters<uint32_t>()).forInterface(INTERFACE_NAME);
+    auto clientConnection = sdbus::createBusConnection();
+    clientConnection->setDispatchBudget({1000, 1s});
+    auto proxy = sdbus::createProxy(*clientConnection, serverConnection->getUniqueName(), OBJECT_PATH);
+    std::vector<uint32_t> numbers;
+    std::promise<void> allReceived;
+    proxy->uponSignal("numberSignal").onInterface(INTERFACE_NAME).call([&](uint32_t number)
+    {
+        numbers.push_back(number);
+        if (numbers.size() == 1000)
+            allReceived.set_value();
+    });
+
+    // The burst piles up for the client before its event loop starts, so the loop finds many messages per wake-up
+    for (uint32_t i = 0; i < 1000; ++i)
+        object->emitSignal("numberSignal").onInterface(INTERFACE_NAME).withArguments(i);
+    std::this_thread::sleep_for(50ms);
+    clientConnection->enterEventLoopAsync();
+
+    ASSERT_THAT(allReceived.get_future().wait_for(5s), Eq(std::future_status::ready));
+    for (uint32_t i = 0; i < 1000; ++i)
+        ASSERT_THAT(numbers[i], Eq(i));
+    ASSERT_THAT(clientConnection->getDispatchBudget().maxMessages, Eq(1000));
+    auto statistics = clientConnection->getStatistics();
+    ASSERT_THAT(statistics.received.signals, Ge(1000U));
+    ASSERT_THAT(statistics.pollWakeups, Lt(statistics.received.signals / 2));
+}
+
+TEST(Connection, ThrowsErrorWhenSettingNegativeBusyPollWindow)
+{
+    auto connection = sdbus::createBusConnection();
+
+    ASSERT_THROW(connection->setBusyPollWindow(-1us), sdbus::Error);
+}
+
+TEST(Connection, ServesDBusMethodCallsInBusyPollMode)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    serverConnection->setBusyPollWindow(500us);
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("ping").implementedAs([](uint32_t number){ return number; })).forInterface(INTERFACE_NAME);
+    serverConnection->enterEventLoopAsync();
+    auto clientConnection = sdbus::createBusConnection();
+    clientConnection->setBusyPollWindow(500us);
+    auto proxy = sdbus::createProxy(*clientConnection, serverConnection->getUniqueName(), OBJECT_PATH);
+    clientConnection->enterEventLoopAsync();
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        std::promise<uint32_t> reply;
+        (void)proxy->callMethodAsync("ping").onInterface(INTERFACE_NAME).withArguments(i).uponReplyInvoke([&](std::optional<sdbus::Error> /*error*/, uint32_t number)
+        {
+            reply.set_value(number);
+        });
+        ASSERT_THAT(reply.get_future().get(), Eq(i));
+    }
+    ASSERT_THAT(serverConnection->getBusyPollWindow(), Eq(500us));
+    // Leaving the event loop in the middle of busy polling must work, too
+    serverConnection->leaveEventLoop();
+    clientConnection->leaveEventLoop();
+}
+
+TEST(Connection, ThrowsErrorWhenSettingLowOutboundQueueWatermarkNotBelowHighOne)
+{
+    auto connection = sdbus::createBusConnection();
+
+    ASSERT_THROW(connection->setOutboundQueueWatermarks({4, 4}), sdbus::Error);
+    ASSERT_NO_THROW(connection->setOutboundQueueWatermarks({0, 0}));
+}
+
+TEST(Connection, PausesAndResumesSignalProducerAtOutboundQueueWatermarks)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setOutboundQueueWatermarks({4, 1});
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    std::mutex mutex;
+    std::vector<bool> transitions;
+    std::promise<void> drained;
+    connection->setOutboundQueueHandler([&](bool congested)
+    {
+        const std::lock_guard lock(mutex);
+        transitions.push_back(congested);
+        if (!congested)
+            drained.set_value();
+    });
+    const std::vector<uint8_t> payload(1024 * 1024);
+
+    // With no event loop running, messages that don't fit into the socket buffer pile up in the outbound queue
+    std::size_t sentSignals = 0;
+    for (; sentSignals < 1000; ++sentSignals)
+    {
+        auto signal = object->createSignal(INTERFACE_NAME, sdbus::SignalName{"bulkSignal"});
+        signal << payload;
+        if (!signal.trySend())
+            break;
+    }
+    ASSERT_THAT(sentSignals, Lt(1000U));
+    ASSERT_THAT(connection->getOutboundQueueLength(), Ge(4U));
+
+    connection->enterEventLoopAsync();
+
+    ASSERT_THAT(drained.get_future().wait_for(10s), Eq(std::future_status::ready));
+    const std::lock_guard lock(mutex);
+    ASSERT_THAT(transitions, ElementsAre(true, false));
+}
+
+TEST(Connection, NotifiesOutboundQueueHandlerOfAlternatingTransitionsDetectedInDifferentThreads)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setOutboundQueueWatermarks({8, 2});
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    std::mutex mutex;
+    std::vector<bool> transitions;
+    connection->setOutboundQueueHandler([&](bool congested)
+    {
+        const std::lock_guard lock(mutex);
+        transitions.push_back(congested);
+    });
+    connection->enterEventLoopAsync();
+    const std::vector<uint8_t> payload(64 * 1024);
+
+    // Producers detect congestion while the event loop thread detects draining of the queue
+    {
+        std::vector<std::jthread> producers;
+        for (int i = 0; i < 4; ++i)
+            producers.emplace_back([&]()
+            {
+                for (int j = 0; j < 100; ++j)
+                {
+                    auto signal = object->createSignal(INTERFACE_NAME, sdbus::SignalName{"bulkSignal"});
+                    signal << payload;
+                    signal.send();
+                }
+            });
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + 10s;
+    auto drained = [&]()
+    {
+        const std::lock_guard lock(mutex);
+        return connection->getOutboundQueueLength() == 0 && (transitions.empty() || !transitions.back());
+    };
+    while (!drained() && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(10ms);
+
+    const std::lock_guard lock(mutex);
+    ASSERT_FALSE(transitions.empty() || transitions.back());
+    for (std::size_t i = 0; i < transitions.size(); ++i)
+        ASSERT_THAT(transitions[i], Eq(i % 2 == 0)) << "at transition " << i;
+}
+
+TEST(Connection, DoesNotDeadlockWhenHandlersAndOtherThreadsSendMessagesUnderOutboundQueueWatermarks)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setOutboundQueueWatermarks({100000, 1});
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("ping").implementedAs([&](){ object->emitSignal("pinged").onInterface(INTERFACE_NAME); return 42; }))
+          .forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    // Stopped and joined upon leaving the scope, even if an assertion fails
+    std::jthread producer([&](std::stop_token stop)
+    {
+        while (!stop.stop_requested())
+            object->emitSignal("produced").onInterface(INTERFACE_NAME);
+    });
+
+    auto proxy = sdbus::createLightWeightProxy(connection->getUniqueName(), OBJECT_PATH);
+    int result{};
+    for (int i = 0; i < 20; ++i)
+        ASSERT_NO_THROW(proxy->callMethod("ping").onInterface(INTERFACE_NAME).withTimeout(5s).storeResultsTo(result));
+}
+
+TEST(Connection, CollectsStatisticsOfServedMethodCalls)
+{
+    auto connection = sdbus::createBusConnection();
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("ping").implementedAs([](){ return 42; })).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createLightWeightProxy(connection->getUniqueName(), OBJECT_PATH);
+    int result{};
+    for (int i = 0; i < 10; ++i)
+        proxy->callMethod("ping").onInterface(INTERFACE_NAME).storeResultsTo(result);
+    // Replies to async calls bypass the sd-bus filter, which used to make them invisible to the statistics
+    auto clientConnection = sdbus::createBusConnection();
+    auto asyncProxy = sdbus::createProxy(*clientConnection, connection->getUniqueName(), OBJECT_PATH);
+    clientConnection->enterEventLoopAsync();
+    for (int i = 0; i < 10; ++i)
+        asyncProxy->callMethodAsync("ping").onInterface(INTERFACE_NAME).getResultAsFuture<int>().get();
+    clientConnection->leaveEventLoop();
+    connection->leaveEventLoop(); // The last dispatch is only recorded after the reply has been sent
+
+    auto statistics = connection->getStatistics();
+    ASSERT_THAT(statistics.received.methodCalls, Ge(20U));
+    ASSERT_THAT(statistics.sent.methodReplies, Ge(20U));
+    ASSERT_THAT(statistics.pollWakeups, Ge(1U));
+    ASSERT_THAT(std::accumulate(statistics.handlerDuration.begin(), statistics.handlerDuration.end(), uint64_t{}), Ge(20U));
+    ASSERT_THAT(std::accumulate(statistics.dispatchLatency.begin(), statistics.dispatchLatency.end(), uint64_t{}), Ge(20U));
+    ASSERT_THAT(statistics.handlerTime.count(), Gt(0));
+    auto clientStatistics = clientConnection->getStatistics();
+    ASSERT_THAT(clientStatistics.received.methodReplies, Ge(10U));
+    ASSERT_THAT(std::accumulate(clientStatistics.handlerDuration.begin(), clientStatistics.handlerDuration.end(), uint64_t{}), Ge(10U));
+}
+
+TEST(Connection, ThrowsErrorWhenSettingNegativeDispatchWatchdogThreshold)
+{
+    auto connection = sdbus::createBusConnection();
+
+    ASSERT_THROW(connection->setDispatchWatchdog(-1ms, {}), sdbus::Error);
+}
+
+TEST(Connection, ReportsDispatchStallCausedBySlowMethodHandler)
+{
+    auto connection = sdbus::createBusConnection();
+    std::promise<sdbus::IConnection::DispatchStall> reportedStall;
+    connection->setDispatchWatchdog(20ms, [&](const sdbus::IConnection::DispatchStall& stall)
+    {
+        if (stall.memberName == "slowPing") // Fast handlers may happen to stall, too, on a busy machine
+            reportedStall.set_value(stall);
+    });
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable( sdbus::registerMethod("ping").implementedAs([](){ return 42; })
+                     , sdbus::registerMethod("slowPing").implementedAs([](){ std::this_thread::sleep_for(200ms); return 42; }) )
+                     .forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createLightWeightProxy(connection->getUniqueName(), OBJECT_PATH);
+    int result{};
+    for (int i = 0; i < 10; ++i)
+        proxy->callMethod("ping").onInterface(INTERFACE_NAME).storeResultsTo(result);
+    proxy->callMethod("slowPing").onInterface(INTERFACE_NAME).storeResultsTo(result);
+
+    auto stallFuture = reportedStall.get_future();
+    ASSERT_THAT(stallFuture.wait_for(1s), Eq(std::future_status::ready));
+    auto stall = stallFuture.get();
+    ASSERT_THAT(stall.interfaceName, Eq(INTERFACE_NAME));
+    ASSERT_THAT(stall.objectPath, Eq(OBJECT_PATH));
+    ASSERT_FALSE(stall.sender.empty());
+    ASSERT_THAT(stall.duration, Ge(20ms));
+    ASSERT_THAT(connection->getDispatchStallCounts().at(INTERFACE_NAME + ".slowPing"), Eq(1U));
+}
+
+TEST(Connection, ServesDBusMethodCallsAlongWithUserTimers)
+{
+    auto connection = sdbus::createBusConnection();
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("ping").implementedAs([](){ return 42; })).forInterface(INTERFACE_NAME);
+    std::atomic<int> expirations{0};
+    auto timer = connection->addTimer(1ms, [&](){ ++expirations; }, sdbus::return_slot);
+    connection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createLightWeightProxy(connection->getUniqueName(), OBJECT_PATH);
+    int result{};
+    for (int i = 0; i < 100; ++i)
+        proxy->callMethod("ping").onInterface(INTERFACE_NAME).storeResultsTo(result);
+
+    ASSERT_THAT(result, Eq(42));
+    ASSERT_GT(expirations, 0);
+}
+
+TEST(Connection, ServesDBusMethodCallsOnSingleThreadedConnection)
+{
+    auto connection = sdbus::createBusConnection(sdbus::single_threaded);
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("ping").implementedAs([](){ return 42; })).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createLightWeightProxy(connection->getUniqueName(), OBJECT_PATH);
+    int result{};
+    proxy->callMethod("ping").onInterface(INTERFACE_NAME).storeResultsTo(result);
+    connection->leaveEventLoop(); // The object may only be destroyed by this thread once the event loop thread is gone
+
+    ASSERT_THAT(result, Eq(42));
+}
+
+TEST(Connection, ThrowsErrorWhenEnablingWorkerThreadsOnSingleThreadedConnection)
+{
+    auto connection = sdbus::createBusConnection(sdbus::single_threaded);
+
+    ASSERT_THROW(connection->setDispatchThreadCount(2), sdbus::Error);
+}
+
+TEST(Connection, ThrowsErrorWhenEnablingNonBlockingMethodCallsOnSingleThreadedConnection)
+{
+    auto connection = sdbus::createBusConnection(sdbus::single_threaded);
+
+    ASSERT_THROW(connection->setNonBlockingMethodCalls(true), sdbus::Error);
+}
+
+TEST(Connection, UsesIoUringEventLoopBackendIfAvailableOrFallsBackToEpoll)
+{
+    auto connection = sdbus::createBusConnection();
+
+    connection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::IoUring);
+
+    ASSERT_THAT( connection->getEventLoopBackend()
+               , ::testing::AnyOf(Eq(sdbus::IConnection::EventLoopBackend::IoUring), Eq(sdbus::IConnection::EventLoopBackend::Epoll)) );
+}
+
+TEST(Connection, ServesFdWatchesAndTimersWithIoUringEventLoopBackend)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::IoUring);
+    std::array<int, 2> pipeFds{};
+    ASSERT_THAT(pipe(pipeFds.data()), Eq(0));
+    std::promise<void> fdReady;
+    auto watch = connection->addFdWatch(pipeFds[0], POLLIN, [&](short int /*revents*/)
+    {
+        char data{};
+        (void)read(pipeFds[0], &data, 1);
+        fdReady.set_value();
+    }, sdbus::return_slot);
+    std::atomic<int> expirations{0};
+    auto timer = connection->addTimer(10ms, [&](){ ++expirations; }, sdbus::return_slot);
+    connection->enterEventLoopAsync();
+
+    ASSERT_THAT(write(pipeFds[1], "x", 1), Eq(1));
+
+    ASSERT_THAT(fdReady.get_future().wait_for(1s), Eq(std::future_status::ready));
+    std::this_thread::sleep_for(100ms);
+    ASSERT_GE(expirations, 3);
+    connection->leaveEventLoop();
+    watch.reset();
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
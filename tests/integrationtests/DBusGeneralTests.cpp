@@ -37,6 +37,7 @@
 #include <gmock/gmock.h>
 #include <string_view>
 #include <chrono>
+#include <thread>
 #include <type_traits>
 
 using ::testing::Eq;
@@ -170,6 +171,38 @@ TYPED_TEST(AConnection, WillNotPassToMatchCallbackMessagesThatDoNotMatchTheRule)
     ASSERT_FALSE(waitUntil([&](){ return numberOfMatchingMessages > 2; }, 1s));
 }
 
+TYPED_TEST(AConnection, PostsMatchCallbackToGivenExecutor)
+{
+    auto matchRule = "sender='" + SERVICE_NAME + "',path='" + OBJECT_PATH + "'";
+    QueueingExecutor executor;
+    std::thread::id callbackThread;
+    auto slot = this->s_proxyConnection->addMatch(matchRule, [&](const sdbus::Message& /*msg*/)
+    {
+        callbackThread = std::this_thread::get_id();
+    }, executor, sdbus::return_slot);
+
+    this->m_adaptor->emitSimpleSignal();
+
+    ASSERT_TRUE(waitUntil([&](){ return executor.runOne(); }));
+    ASSERT_THAT(callbackThread, Eq(std::this_thread::get_id()));
+}
+
+TYPED_TEST(AConnection, PostsMatchCallbackToConnectionExecutor)
+{
+    auto matchRule = "sender='" + SERVICE_NAME + "',path='" + OBJECT_PATH + "'";
+    QueueingExecutor executor;
+    auto con = sdbus::createBusConnection();
+    con->setCallbackExecutor(executor);
+    con->enterEventLoopAsync();
+    std::atomic matchingMessageReceived{false};
+    auto slot = con->addMatch(matchRule, [&](const sdbus::Message& /*msg*/){ matchingMessageReceived = true; }, sdbus::return_slot);
+
+    this->m_adaptor->emitSimpleSignal();
+
+    ASSERT_TRUE(waitUntil([&](){ return executor.runOne(); }));
+    ASSERT_TRUE(matchingMessageReceived);
+}
+
 // A simple direct connection test similar in nature to https://github.com/systemd/systemd/blob/main/src/libsystemd/sd-bus/test-bus-server.c
 TEST_F(ADirectConnection, CanBeUsedBetweenClientAndServer)
 {
@@ -29,13 +29,17 @@
 #include "Defs.h"
 #include <sdbus-c++/sdbus-c++.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <future>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <map>
 #include <memory>
 #include <string>
+#include <numeric>
 #include <chrono>
+#include <thread>
 #include <vector>
 #include <variant>
 
@@ -363,6 +367,72 @@ TYPED_TEST(SdbusTestObject, CanRegisterAdditionalVTableDynamicallyAtAnyTime)
     ASSERT_THAT(result, Eq(8));
 }
 
+TYPED_TEST(SdbusTestObject, CanReceiveMethodArgumentsAsStringViewsIntoTheIncomingCall)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("concatenate").implementedAs([](std::string_view lhs, const std::vector<std::string_view>& rhs)
+                                          {
+                                              std::string result{lhs};
+                                              for (const auto& str : rhs)
+                                                  result += str;
+                                              return result;
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    std::string result;
+    proxy->callMethod("concatenate").onInterface(interfaceName).withArguments("abc", std::vector<std::string>{"de", "", "f"}).storeResultsTo(result);
+
+    ASSERT_THAT(result, Eq("abcdef"));
+}
+
+#ifdef __cpp_lib_span
+TYPED_TEST(SdbusTestObject, CanReceiveMethodArgumentsAsStdSpansIntoTheIncomingCall)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("checksum").implementedAs([](std::span<const uint8_t> blob)
+                                          {
+                                              return std::accumulate(blob.begin(), blob.end(), uint32_t{0});
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    const std::vector<uint8_t> blob(4096, 3);
+    uint32_t result{};
+    proxy->callMethod("checksum").onInterface(interfaceName).withArguments(blob).storeResultsTo(result);
+
+    ASSERT_THAT(result, Eq(3U * 4096U));
+}
+#endif
+
+TYPED_TEST(SdbusTestObject, CanPassLargePayloadsViaSharedBuffersInBothDirections)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("reverse").implementedAs([](const sdbus::SharedBuffer& buffer)
+                                          {
+                                              return sdbus::SharedBuffer::create(buffer.size(), [&](void* data)
+                                              {
+                                                  std::reverse_copy(buffer.data(), buffer.data() + buffer.size(), static_cast<uint8_t*>(data));
+                                              });
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    std::vector<uint8_t> payload(sdbus::SharedBuffer::DEFAULT_INLINE_THRESHOLD + 1);
+    std::iota(payload.begin(), payload.end(), uint8_t{0});
+    sdbus::SharedBuffer result;
+    proxy->callMethod("reverse").onInterface(interfaceName).withArguments(sdbus::SharedBuffer{payload.data(), payload.size()}).storeResultsTo(result);
+
+    ASSERT_TRUE(result.isShared());
+    ASSERT_THAT(std::vector(result.data(), result.data() + result.size()), Eq(std::vector(payload.rbegin(), payload.rend())));
+}
+
 TYPED_TEST(SdbusTestObject, CanUnregisterAdditionallyRegisteredVTableAtAnyTime)
 {
     auto& object = this->m_adaptor->getObject();
@@ -378,3 +448,64 @@ TYPED_TEST(SdbusTestObject, CanUnregisterAdditionallyRegisteredVTableAtAnyTime)
     auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
     ASSERT_THROW(proxy->callMethod("subtract").onInterface(interfaceName).withArguments(10, 2), sdbus::Error);
 }
+
+TYPED_TEST(SdbusTestObject, CallsMethodThatThrowsErrorInNonBlockingMode)
+{
+    this->s_proxyConnection->setNonBlockingMethodCalls(true);
+
+    try
+    {
+        this->m_proxy->throwError();
+        FAIL() << "Expected sdbus::Error exception";
+    }
+    catch (const sdbus::Error& e)
+    {
+        ASSERT_THAT(e.getName(), Eq("org.freedesktop.DBus.Error.AccessDenied"));
+        ASSERT_THAT(e.getMessage(), Eq("A test error occurred (Operation not permitted)"));
+    }
+    catch(...)
+    {
+        FAIL() << "Expected sdbus::Error exception";
+    }
+}
+
+TYPED_TEST(SdbusTestObject, ThrowsTimeoutErrorWhenMethodTimesOutInNonBlockingMode)
+{
+    this->s_proxyConnection->setNonBlockingMethodCalls(true);
+
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+        this->m_proxy->doOperationWithTimeout(1us, (1s).count()); // The operation will take 1s, but the timeout is 1us, so we should time out
+        FAIL() << "Expected sdbus::Error exception";
+    }
+    catch (const sdbus::Error& e)
+    {
+        ASSERT_THAT(e.getName(), AnyOf("org.freedesktop.DBus.Error.Timeout", "org.freedesktop.DBus.Error.NoReply"));
+        auto measuredTimeout = std::chrono::steady_clock::now() - start;
+        ASSERT_THAT(measuredTimeout, Le(50ms));
+    }
+    catch(...)
+    {
+        FAIL() << "Expected sdbus::Error exception";
+    }
+}
+
+using SdbusTestObjectWithInternalEventLoop = TestFixture<SdBusCppLoop>;
+
+TEST_F(SdbusTestObjectWithInternalEventLoop, DoesNotBlockConnectionWhileWaitingForMethodReplyInNonBlockingMode)
+{
+    s_proxyConnection->setNonBlockingMethodCalls(true);
+
+    // The server replies to this call asynchronously from another thread after 1s
+    auto slowCall = std::async(std::launch::async, [this](){ return m_proxy->doOperationAsync(1000); });
+    std::this_thread::sleep_for(50ms);
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = m_proxy->doOperationAsync(0);
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    ASSERT_THAT(result, Eq(0));
+    ASSERT_THAT(duration, Le(500ms)); // Would be ~950ms if the connection was blocked by the slow call
+    ASSERT_THAT(slowCall.get(), Eq(1000));
+}
@@ -33,12 +33,19 @@
 #include <cstdint>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <array>
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <span>
 #include <string>
+#include <thread>
+#include <vector>
 
 using ::testing::Eq;
 using ::testing::DoubleEq;
 using ::testing::NotNull;
+using ::testing::ElementsAre;
 using namespace std::chrono_literals;
 using namespace sdbus::test;
 
@@ -114,6 +121,23 @@ TYPED_TEST(SdbusTestObject, EmitsSignalWithoutRegistrationSuccessfully)
     ASSERT_THAT(this->m_proxy->m_signatureFromSignal["platform"], Eq(sdbus::Signature{"av"}));
 }
 
+#ifdef __cpp_lib_span
+TYPED_TEST(SdbusTestObject, CanReceiveSignalArgumentAsStdSpanPointingIntoTheSignalMessage)
+{
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    std::vector<double> samples;
+    std::atomic<bool> gotSignal{false};
+    auto slot = proxy->uponSignal("samplesSignal")
+                      .onInterface(INTERFACE_NAME)
+                      .call([&](std::span<const double> data){ samples.assign(data.begin(), data.end()); gotSignal = true; }, sdbus::return_slot);
+
+    this->m_adaptor->getObject().emitSignal("samplesSignal").onInterface(INTERFACE_NAME).withArguments(std::vector{1.5, -2.5, 3.5});
+
+    ASSERT_TRUE(waitUntil(gotSignal));
+    ASSERT_THAT(samples, ElementsAre(1.5, -2.5, 3.5));
+}
+#endif
+
 TYPED_TEST(SdbusTestObject, CanAccessAssociatedSignalMessageInSignalHandler)
 {
     this->m_adaptor->emitSimpleSignal();
@@ -163,3 +187,94 @@ TYPED_TEST(SdbusTestObject, ReRegistersSignalHandler)
 
     ASSERT_TRUE(waitUntil(this->m_proxy->m_gotSimpleSignal));
 }
+
+TYPED_TEST(SdbusTestObject, PostsSignalHandlerToProxyExecutor)
+{
+    QueueingExecutor executor;
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    proxy->setCallbackExecutor(executor);
+    std::thread::id handlerThread;
+    auto slot = proxy->uponSignal("simpleSignal")
+                      .onInterface(INTERFACE_NAME)
+                      .call([&](){ handlerThread = std::this_thread::get_id(); }, sdbus::return_slot);
+
+    this->m_adaptor->emitSimpleSignal();
+
+    ASSERT_TRUE(waitUntil([&](){ return executor.runOne(); }));
+    ASSERT_THAT(handlerThread, Eq(std::this_thread::get_id()));
+}
+
+TYPED_TEST(SdbusTestObject, PostsSignalHandlerToItsOwnExecutorRatherThanToProxyExecutor)
+{
+    QueueingExecutor proxyExecutor;
+    QueueingExecutor signalExecutor;
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    proxy->setCallbackExecutor(proxyExecutor);
+    std::atomic<bool> gotSignal{false};
+    auto slot = proxy->uponSignal("simpleSignal")
+                      .onInterface(INTERFACE_NAME)
+                      .withExecutor(signalExecutor)
+                      .call([&](){ gotSignal = true; }, sdbus::return_slot);
+
+    this->m_adaptor->emitSimpleSignal();
+
+    ASSERT_TRUE(waitUntil([&](){ return signalExecutor.runOne(); }));
+    ASSERT_TRUE(gotSignal);
+    ASSERT_FALSE(proxyExecutor.runOne());
+}
+
+TYPED_TEST(SdbusTestObject, DoesNotInvokeQueuedSignalHandlerOnceUnsubscribed)
+{
+    QueueingExecutor executor;
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+    std::atomic<bool> gotSignal{false};
+    auto slot = proxy->uponSignal("simpleSignal")
+                      .onInterface(INTERFACE_NAME)
+                      .withExecutor(executor)
+                      .call([&](){ gotSignal = true; }, sdbus::return_slot);
+
+    this->m_adaptor->emitSimpleSignal();
+    ASSERT_TRUE(waitUntil([&](){ const std::lock_guard lock(executor.mutex); return !executor.queue.empty(); }));
+    slot.reset();
+
+    ASSERT_TRUE(executor.runOne());
+    ASSERT_FALSE(gotSignal);
+}
+
+TYPED_TEST(SdbusTestObject, HoldsBackSignalsEmittedUnderCorkUntilCorkIsReleased)
+{
+    auto cork = this->s_adaptorConnection->cork();
+
+    this->m_adaptor->emitSimpleSignal();
+    ASSERT_FALSE(waitUntil(this->m_proxy->m_gotSimpleSignal, 100ms));
+    cork.reset();
+
+    ASSERT_TRUE(waitUntil(this->m_proxy->m_gotSimpleSignal));
+}
+
+TYPED_TEST(SdbusTestObject, EmitsBatchOfSignalsInOrder)
+{
+    auto& object = this->m_adaptor->getObject();
+    auto simpleSignal = object.createSignal(INTERFACE_NAME, sdbus::SignalName{"simpleSignal"});
+    auto signalWithMap = object.createSignal(INTERFACE_NAME, sdbus::SignalName{"signalWithMap"});
+    signalWithMap << std::map<int32_t, std::string>{{0, "zero"}};
+
+    this->s_adaptorConnection->sendBatch({simpleSignal, signalWithMap});
+
+    ASSERT_TRUE(waitUntil(this->m_proxy->m_gotSignalWithMap));
+    ASSERT_TRUE(this->m_proxy->m_gotSimpleSignal);
+    ASSERT_THAT(this->m_proxy->m_mapFromSignal[0], Eq("zero"));
+}
+
+TYPED_TEST(SdbusTestObject, EmitsBatchOfSignalsGivenAsSpan)
+{
+    auto& object = this->m_adaptor->getObject();
+    auto signalWithMap = object.createSignal(INTERFACE_NAME, sdbus::SignalName{"signalWithMap"});
+    signalWithMap << std::map<int32_t, std::string>{{0, "zero"}};
+    const std::array<sdbus::Message, 2> batch{object.createSignal(INTERFACE_NAME, sdbus::SignalName{"simpleSignal"}), signalWithMap};
+
+    this->s_adaptorConnection->sendBatch(std::span{batch});
+
+    ASSERT_TRUE(waitUntil(this->m_proxy->m_gotSignalWithMap));
+    ASSERT_TRUE(this->m_proxy->m_gotSimpleSignal);
+}
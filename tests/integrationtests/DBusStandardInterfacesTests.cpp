@@ -101,6 +101,18 @@ TYPED_TEST(SdbusTestObject, GetsPropertyAsynchronouslyViaPropertiesInterfaceWith
     ASSERT_THAT(future.get().template get<std::string>(), Eq(DEFAULT_STATE_VALUE));
 }
 
+#ifdef __cpp_lib_coroutine
+TYPED_TEST(SdbusTestObject, GetsPropertyAsynchronouslyViaPropertiesInterfaceWithAwaitable)
+{
+    auto coroutine = [](TestProxy& proxy) -> FutureCoroutine<sdbus::Variant>
+    {
+        co_return co_await proxy.GetAsync(INTERFACE_NAME, "state", sdbus::with_awaitable);
+    }(*this->m_proxy);
+
+    ASSERT_THAT(coroutine.future.get().template get<std::string>(), Eq(DEFAULT_STATE_VALUE));
+}
+#endif // __cpp_lib_coroutine
+
 TYPED_TEST(SdbusTestObject, SetsPropertyViaPropertiesInterface)
 {
     uint32_t const newActionValue = 2345;
@@ -158,6 +170,22 @@ TYPED_TEST(SdbusTestObject, SetsPropertyAsynchronouslyViaPropertiesInterfaceWith
     ASSERT_THAT(this->m_proxy->action(), Eq(newActionValue));
 }
 
+#ifdef __cpp_lib_coroutine
+TYPED_TEST(SdbusTestObject, SetsPropertyAsynchronouslyViaPropertiesInterfaceWithAwaitable)
+{
+    uint32_t const newActionValue = 2348;
+
+    auto coroutine = [](TestProxy& proxy, uint32_t value) -> FutureCoroutine<bool>
+    {
+        co_await proxy.SetAsync(INTERFACE_NAME, "action", sdbus::Variant{value}, sdbus::with_awaitable);
+        co_return true;
+    }(*this->m_proxy, newActionValue);
+
+    ASSERT_NO_THROW(coroutine.future.get());
+    ASSERT_THAT(this->m_proxy->action(), Eq(newActionValue));
+}
+#endif // __cpp_lib_coroutine
+
 TYPED_TEST(SdbusTestObject, GetsAllPropertiesViaPropertiesInterface)
 {
     const auto properties = this->m_proxy->GetAll(INTERFACE_NAME);
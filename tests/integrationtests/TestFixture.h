@@ -41,6 +41,12 @@
 #include <thread>
 #include <chrono>
 #include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -78,6 +84,8 @@ private:
     {
         m_proxy.reset();
         m_adaptor.reset();
+        // The connection is shared by all tests, so undo modes a test may have switched on, even if it failed half-way
+        s_proxyConnection->setNonBlockingMethodCalls(false);
     }
 
 public:
@@ -90,6 +98,7 @@ public:
 };
 
 struct SdBusCppLoop{};
+struct SdBusCppIoUringLoop{};
 struct SdEventLoop{};
 
 template <typename EventLoop>
@@ -116,6 +125,31 @@ public:
     }
 };
 
+// Fixture working upon internal sdbus-c++ event loop with io_uring backend (or epoll, if io_uring is unavailable)
+template <>
+class TestFixture<SdBusCppIoUringLoop> : public BaseTestFixture
+{
+public:
+    static void SetUpTestSuite()
+    {
+        BaseTestFixture::SetUpTestSuite();
+        s_proxyConnection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::IoUring);
+        s_adaptorConnection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::IoUring);
+        s_proxyConnection->enterEventLoopAsync();
+        s_adaptorConnection->enterEventLoopAsync();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50)); // Give time for the proxy connection to start listening to signals
+    }
+
+    static void TearDownTestSuite()
+    {
+        BaseTestFixture::TearDownTestSuite();
+        s_adaptorConnection->leaveEventLoop();
+        s_proxyConnection->leaveEventLoop();
+        s_adaptorConnection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::Epoll);
+        s_proxyConnection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::Epoll);
+    }
+};
+
 #ifndef SDBUS_basu // sd_event integration is not supported in basu-based sdbus-c++
 
 // Fixture working upon attached external sd-event loop
@@ -171,10 +205,10 @@ private:
     static int s_eventExitFd;
 };
 
-using EventLoopTags = ::testing::Types<SdBusCppLoop, SdEventLoop>;
+using EventLoopTags = ::testing::Types<SdBusCppLoop, SdBusCppIoUringLoop, SdEventLoop>;
 
 #else // SDBUS_basu
-using EventLoopTags = ::testing::Types<SdBusCppLoop>;
+using EventLoopTags = ::testing::Types<SdBusCppLoop, SdBusCppIoUringLoop>;
 #endif // SDBUS_basu
 
 TYPED_TEST_SUITE(TestFixture, EventLoopTags);
@@ -287,6 +321,53 @@ inline bool waitUntil(std::atomic<bool>& flag, std::chrono::milliseconds timeout
     return waitUntil([&flag]() -> bool { return flag; }, timeout);
 }
 
+// Collects the posted callbacks, to be run by the test thread
+struct QueueingExecutor
+{
+    void post(std::function<void()> fnc)
+    {
+        const std::lock_guard lock(mutex);
+        queue.push_back(std::move(fnc));
+    }
+
+    bool runOne()
+    {
+        std::function<void()> fnc;
+        {
+            const std::lock_guard lock(mutex);
+            if (queue.empty())
+                return false;
+            fnc = std::move(queue.front());
+            queue.erase(queue.begin());
+        }
+        fnc();
+        return true;
+    }
+
+    std::mutex mutex;
+    std::vector<std::function<void()>> queue;
+};
+
+#ifdef __cpp_lib_coroutine
+// Minimal eagerly started coroutine type that hands its result over through a std::future
+template <typename T>
+struct FutureCoroutine
+{
+    struct promise_type
+    {
+        FutureCoroutine get_return_object() { return {promise.get_future()}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_value(T value) { promise.set_value(std::move(value)); }
+        void unhandled_exception() { promise.set_exception(std::current_exception()); }
+
+        std::promise<T> promise;
+    };
+
+    std::future<T> future;
+};
+#endif // __cpp_lib_coroutine
+
 } // namespace sdbus::test
 
 #endif /* SDBUS_CPP_INTEGRATIONTESTS_TESTFIXTURE_H_ */
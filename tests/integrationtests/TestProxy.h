@@ -111,6 +111,10 @@ public:
     std::future<std::map<int32_t, std::string>> doOperationWithLargeDataClientSideAsync(const std::map<int32_t, std::string>& largeParam, with_future_t);
     std::future<MethodReply> doOperationClientSideAsyncOnBasicAPILevel(uint32_t param);
     std::future<void> doErroneousOperationClientSideAsync(with_future_t);
+#ifdef __cpp_lib_coroutine
+    sdbus::Awaitable<uint32_t> doOperationClientSideAsync(uint32_t param, with_awaitable_t);
+    sdbus::Awaitable<> doErroneousOperationClientSideAsync(with_awaitable_t);
+#endif // __cpp_lib_coroutine
     void doErroneousOperationClientSideAsync();
     void doOperationClientSideAsyncWithTimeout(const std::chrono::microseconds &timeout, uint32_t param);
     int32_t callNonexistentMethod();
@@ -0,0 +1,107 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file SyscallCounter.h
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CPP_PERFTESTS_SYSCALLCOUNTER_H_
+#define SDBUS_CPP_PERFTESTS_SYSCALLCOUNTER_H_
+
+#include <cstdint>
+#include <fstream>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// Counts system calls made by the thread that created the counter, through the raw_syscalls:sys_enter
+// tracepoint. That needs tracefs to be mounted and kernel.perf_event_paranoid to allow it (or root).
+// If not possible, isAvailable() returns false.
+class SyscallCounter
+{
+public:
+    SyscallCounter()
+    {
+        auto id = readTracepointId();
+        if (id == 0)
+            return;
+
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_TRACEPOINT;
+        attr.size = sizeof(attr);
+        attr.config = id;
+        attr.disabled = 1;
+        fd_ = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0 /*this thread*/, -1, -1, 0));
+    }
+
+    SyscallCounter(const SyscallCounter&) = delete;
+    SyscallCounter& operator=(const SyscallCounter&) = delete;
+    SyscallCounter(SyscallCounter&&) = delete;
+    SyscallCounter& operator=(SyscallCounter&&) = delete;
+
+    ~SyscallCounter()
+    {
+        if (fd_ >= 0)
+            close(fd_);
+    }
+
+    [[nodiscard]] bool isAvailable() const
+    {
+        return fd_ >= 0;
+    }
+
+    void start() // NOLINT(readability-make-member-function-const)
+    {
+        if (fd_ < 0)
+            return;
+        (void)ioctl(fd_, PERF_EVENT_IOC_RESET, 0); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        (void)ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0); // NOLINT(cppcoreguidelines-pro-type-vararg)
+    }
+
+    uint64_t stop() // NOLINT(readability-make-member-function-const)
+    {
+        if (fd_ < 0)
+            return 0;
+        (void)ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        uint64_t count{};
+        return read(fd_, &count, sizeof(count)) == sizeof(count) ? count : 0;
+    }
+
+private:
+    static uint64_t readTracepointId()
+    {
+        for (const auto* path : { "/sys/kernel/tracing/events/raw_syscalls/sys_enter/id"
+                                , "/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id" })
+        {
+            std::ifstream file(path);
+            uint64_t id{};
+            if (file >> id)
+                return id;
+        }
+        return 0;
+    }
+
+    int fd_{-1};
+};
+
+#endif /* SDBUS_CPP_PERFTESTS_SYSCALLCOUNTER_H_ */
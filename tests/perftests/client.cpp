@@ -25,6 +25,7 @@
  */
 
 #include "perftests-proxy.h"
+#include "SyscallCounter.h"
 #include <cstdint>
 #include <cstddef>
 #include <cstdlib>
@@ -37,6 +38,8 @@
 #include <chrono>
 #include <cassert>
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -51,6 +54,12 @@ public:
         registerProxy();
     }
 
+    PerftestProxy(sdbus::IConnection& connection, sdbus::ServiceName destination, sdbus::ObjectPath objectPath)
+        : ProxyInterfaces(connection, std::move(destination), std::move(objectPath))
+    {
+        registerProxy();
+    }
+
     PerftestProxy(const PerftestProxy&) = delete;
     PerftestProxy& operator=(const PerftestProxy&) = delete;
     PerftestProxy(PerftestProxy&&) = delete;
@@ -72,13 +81,22 @@ protected:
         ++counter;
 
         if (counter == 1)
+        {
+            // Signal handlers run in the event loop thread, so this counts the event loop's syscalls
+            m_syscallCounter = std::make_unique<SyscallCounter>();
+            m_syscallCounter->start();
             startTime = std::chrono::steady_clock::now();
+        }
         else if (counter == m_msgCount)
         {
             auto stopTime = std::chrono::steady_clock::now();
+            auto syscalls = m_syscallCounter->stop();
             auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stopTime - startTime).count();
             totalDuration += duration;
-            std::cout << "Received " << m_msgCount << " signals in: " << duration << " ms" << '\n';
+            std::cout << "Received " << m_msgCount << " signals in: " << duration << " ms";
+            if (m_syscallCounter->isAvailable())
+                std::cout << " (" << static_cast<double>(syscalls) / m_msgCount << " syscalls per signal)";
+            std::cout << '\n';
             counter = 0;
         }
     }
@@ -86,6 +104,9 @@ protected:
 public:
     unsigned int m_msgSize{};
     unsigned int m_msgCount{};
+
+private:
+    std::unique_ptr<SyscallCounter> m_syscallCounter;
 };
 
 std::string createRandomString(size_t length)
@@ -111,11 +132,24 @@ std::string createRandomString(size_t length)
 
 
 //-----------------------------------------
-int main(int /*argc*/, char */*argv*/[])
+int main(int argc, char *argv[])
 {
+    // Optional arguments: event loop backend (epoll or io_uring), and max number of messages processed per event loop wake-up
+    bool const useIoUring = argc > 1 && std::string{argv[1]} == "io_uring"; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::size_t const maxMessagesPerWakeUp = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto connection = sdbus::createSystemBusConnection();
+    if (useIoUring)
+        connection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::IoUring);
+    if (maxMessagesPerWakeUp > 0)
+        connection->setDispatchBudget({maxMessagesPerWakeUp, connection->getDispatchBudget().maxDuration});
+    std::cout << "Using " << (connection->getEventLoopBackend() == sdbus::IConnection::EventLoopBackend::IoUring ? "io_uring" : "epoll") << " event loop backend" << '\n';
+    std::cout << "Processing up to " << connection->getDispatchBudget().maxMessages << " messages per event loop wake-up" << '\n';
+
     sdbus::ServiceName destination{"org.sdbuscpp.perftests"};
     sdbus::ObjectPath objectPath{"/org/sdbuscpp/perftests"};
-    PerftestProxy client(std::move(destination), std::move(objectPath));
+    PerftestProxy client(*connection, std::move(destination), std::move(objectPath));
+    connection->enterEventLoopAsync();
 
     const unsigned int repetitions{20};
     unsigned int const msgCount = 1000;
@@ -199,5 +233,37 @@ int main(int /*argc*/, char */*argv*/[])
     std::cout << "AVERAGE: " << (totalDuration/repetitions) << " ms" << '\n';
     totalDuration = 0;
 
+    // Run the server with a number of dispatch threads (e.g. `sdbus-c++-perftests-server 4`) to see the throughput scale
+    unsigned int const callerCount = std::max(2U, std::thread::hardware_concurrency());
+    unsigned int const checksumRounds = 1'000'000;
+    std::cout << '\n' << "** Measuring CPU-bound method calls from " << callerCount << " concurrent callers (" << repetitions << " repetitions)..." << '\n' << '\n';
+    std::vector<std::unique_ptr<PerftestProxy>> callers;
+    for (unsigned int i = 0; i < callerCount; ++i)
+        callers.push_back(std::make_unique<PerftestProxy>(sdbus::ServiceName{"org.sdbuscpp.perftests"}, sdbus::ObjectPath{"/org/sdbuscpp/perftests"}));
+    for (unsigned int i = 0; i < repetitions; ++i)
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (auto& caller : callers)
+        {
+            threads.emplace_back([&caller, msgCount, checksumRounds]()
+            {
+                for (unsigned int j = 0; j < msgCount / 10; j++)
+                    (void)caller->computeChecksum(j, checksumRounds);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        auto stopTime = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(stopTime - startTime).count();
+        totalDuration += duration;
+        std::cout << "Called " << callerCount * (msgCount / 10) << " methods in: " << duration << " ms" << '\n';
+
+        std::this_thread::sleep_for(1000ms);
+    }
+
+    std::cout << "AVERAGE: " << (totalDuration/repetitions) << " ms" << '\n';
+    totalDuration = 0;
+
     return 0;
 }
@@ -35,6 +35,7 @@ protected:
     {
         m_object.addVTable( sdbus::registerMethod("sendDataSignals").withInputParamNames("numberOfSignals", "signalMsgSize").implementedAs([this](const uint32_t& numberOfSignals, const uint32_t& signalMsgSize){ return this->sendDataSignals(numberOfSignals, signalMsgSize); })
                           , sdbus::registerMethod("concatenateTwoStrings").withInputParamNames("string1", "string2").withOutputParamNames("result").implementedAs([this](const std::string& string1, const std::string& string2){ return this->concatenateTwoStrings(string1, string2); })
+                          , sdbus::registerMethod("computeChecksum").withInputParamNames("seed", "rounds").withOutputParamNames("checksum").implementedAs([this](const uint32_t& seed, const uint32_t& rounds){ return this->computeChecksum(seed, rounds); })
                           , sdbus::registerSignal("dataSignal").withParameters<std::string>("data")
                           ).forInterface(INTERFACE_NAME);
     }
@@ -48,6 +49,7 @@ public:
 private:
     virtual void sendDataSignals(const uint32_t& numberOfSignals, const uint32_t& signalMsgSize) = 0;
     virtual std::string concatenateTwoStrings(const std::string& string1, const std::string& string2) = 0;
+    virtual uint32_t computeChecksum(const uint32_t& seed, const uint32_t& rounds) = 0;
 
 private:
     sdbus::IObject& m_object;
@@ -51,6 +51,13 @@ public:
         return result;
     }
 
+    uint32_t computeChecksum(const uint32_t& seed, const uint32_t& rounds)
+    {
+        uint32_t result;
+        m_proxy.callMethod("computeChecksum").onInterface(INTERFACE_NAME).withArguments(seed, rounds).storeResultsTo(result);
+        return result;
+    }
+
 private:
     sdbus::IProxy& m_proxy;
 };
@@ -0,0 +1,173 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file large-payload.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Compares round trips of large payloads through the bus daemon, carried as a plain byte array (`ay`)
+// versus as an sdbus::SharedBuffer, which travels as a sealed memfd and is mapped by the receiver.
+
+namespace {
+
+const sdbus::ServiceName SERVICE_NAME{"org.sdbuscpp.perftests"};
+const sdbus::ObjectPath OBJECT_PATH{"/org/sdbuscpp/perftests/largepayload"};
+const sdbus::InterfaceName INTERFACE_NAME{"org.sdbuscpp.perftests"};
+
+constexpr std::size_t PAGE_BYTES = 4096;
+constexpr std::size_t BYTES_PER_SIZE = std::size_t{1} << 30U; // Number of operations per payload size is derived from this
+
+using Payload = std::vector<uint8_t>;
+
+// Reads one byte of every page, so that the receiver really gets to the data, as any real consumer would,
+// without drowning the transport costs in the costs of processing the data
+uint32_t touchPages(const uint8_t* data, std::size_t size)
+{
+    uint32_t sum{};
+    for (std::size_t i = 0; i < size; i += PAGE_BYTES)
+        sum += data[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return sum;
+}
+
+struct Measurement
+{
+    std::chrono::nanoseconds median;
+    std::chrono::nanoseconds p99;
+    double bandwidth; // MiB/s
+};
+
+Measurement measure(std::size_t payloadSize, std::size_t operations, const std::function<void()>& roundTrip)
+{
+    std::vector<std::chrono::nanoseconds> roundTripTimes;
+    roundTripTimes.reserve(operations);
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < operations; ++i)
+    {
+        auto sendTime = std::chrono::steady_clock::now();
+        roundTrip();
+        roundTripTimes.push_back(std::chrono::steady_clock::now() - sendTime);
+    }
+    auto wallTime = std::chrono::steady_clock::now() - startTime;
+
+    std::sort(roundTripTimes.begin(), roundTripTimes.end());
+    Measurement result{};
+    result.median = roundTripTimes[roundTripTimes.size() / 2];
+    result.p99 = roundTripTimes[roundTripTimes.size() * 99 / 100];
+    result.bandwidth = static_cast<double>(payloadSize * operations) / (1024.0 * 1024.0) / std::chrono::duration<double>(wallTime).count();
+    return result;
+}
+
+void printMeasurement(const std::string& label, const Measurement& measurement)
+{
+    auto toMicroseconds = [](std::chrono::nanoseconds ns){ return std::chrono::duration<double, std::micro>(ns).count(); };
+    std::cout << "  " << label << ": median " << toMicroseconds(measurement.median) << " us, p99 " << toMicroseconds(measurement.p99)
+              << " us, " << static_cast<uint64_t>(measurement.bandwidth) << " MiB/s" << '\n';
+}
+
+std::vector<std::size_t> parseSizes(const std::string& list)
+{
+    std::vector<std::size_t> sizes;
+    std::istringstream stream(list);
+    for (std::string size; std::getline(stream, size, ',');)
+    {
+        sizes.push_back(std::stoul(size));
+        if (sizes.back() == 0)
+            throw std::invalid_argument("zero payload size");
+    }
+    return sizes;
+}
+
+} // namespace
+
+//-----------------------------------------
+int main(int argc, char *argv[])
+{
+    // Optional arguments: comma-separated payload sizes in bytes, and number of operations per payload size
+    std::vector<std::size_t> payloadSizes;
+    try
+    {
+        payloadSizes = parseSizes(argc > 1 ? argv[1] : "4096,65536,1048576,16777216"); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Payload sizes must be positive numbers (" << e.what() << ")" << '\n';
+        return EXIT_FAILURE;
+    }
+    std::size_t const fixedOperations = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto serverConnection = sdbus::createSystemBusConnection(SERVICE_NAME);
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable( sdbus::registerMethod("sendBytes").implementedAs([](const Payload& payload){ return touchPages(payload.data(), payload.size()); })
+                     , sdbus::registerMethod("sendBuffer").implementedAs([](const sdbus::SharedBuffer& buffer){ return touchPages(buffer.data(), buffer.size()); }) )
+          .forInterface(INTERFACE_NAME);
+    serverConnection->enterEventLoopAsync();
+
+    auto clientConnection = sdbus::createSystemBusConnection();
+    auto proxy = sdbus::createProxy(*clientConnection, SERVICE_NAME, OBJECT_PATH);
+    clientConnection->enterEventLoopAsync();
+
+    for (auto payloadSize : payloadSizes)
+    {
+        auto const operations = fixedOperations > 0 ? fixedOperations : std::clamp<std::size_t>(BYTES_PER_SIZE / payloadSize, 10, 10'000);
+        std::cout << payloadSize << " B payload, " << operations << " round trips:" << '\n';
+
+        const Payload payload(payloadSize, 'x');
+        uint32_t result{};
+
+        printMeasurement("Byte array", measure(payloadSize, operations, [&]()
+        {
+            proxy->callMethod("sendBytes").onInterface(INTERFACE_NAME).withArguments(payload).storeResultsTo(result);
+        }));
+
+        // The memfd is filled once and then sent over and over, so the payload itself is not copied on the way
+        const auto buffer = sdbus::SharedBuffer::create(payloadSize, [&](void* data){ std::memcpy(data, payload.data(), payloadSize); }, 0);
+        printMeasurement("Shared buffer", measure(payloadSize, operations, [&]()
+        {
+            proxy->callMethod("sendBuffer").onInterface(INTERFACE_NAME).withArguments(buffer).storeResultsTo(result);
+        }));
+
+        // The sender copies the payload into a fresh memfd for each call
+        printMeasurement("Shared buffer created per call", measure(payloadSize, operations, [&]()
+        {
+            proxy->callMethod("sendBuffer").onInterface(INTERFACE_NAME).withArguments(sdbus::SharedBuffer{payload.data(), payloadSize, 0}).storeResultsTo(result);
+        }));
+    }
+
+    // Both event loops would fail on the bus connection going away otherwise
+    serverConnection->leaveEventLoop();
+    clientConnection->leaveEventLoop();
+}
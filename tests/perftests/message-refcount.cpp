@@ -0,0 +1,95 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file message-refcount.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::string_literals;
+
+namespace {
+
+constexpr std::size_t COPIES_PER_THREAD = 1'000'000;
+
+// Copies and destroys the same message from the given number of threads at once, while another thread keeps
+// creating new messages on the same connection, the way an event loop does. Returns average time per copy.
+double measureCopyTime(const sdbus::PlainMessage& msg, std::size_t threadCount)
+{
+    std::atomic<bool> done{};
+    std::thread messageCreator([&done]()
+    {
+        while (!done)
+            (void)sdbus::createPlainMessage();
+    });
+
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&msg]()
+        {
+            for (std::size_t j = 0; j < COPIES_PER_THREAD; ++j)
+            {
+                sdbus::PlainMessage msgCopy = msg;
+                sdbus::PlainMessage msgMovedCopy = std::move(msgCopy);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    auto stopTime = std::chrono::steady_clock::now();
+
+    done = true;
+    messageCreator.join();
+
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(stopTime - startTime).count();
+    return static_cast<double>(duration) / static_cast<double>(COPIES_PER_THREAD * threadCount);
+}
+
+} // namespace
+
+//-----------------------------------------
+int main(int argc, char *argv[])
+{
+    // Optional argument: max number of copying threads
+    std::size_t const maxThreadCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 8; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    auto msg = sdbus::createPlainMessage();
+    msg << "I am a message shared among threads"s;
+    msg.seal();
+
+    for (std::size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+    {
+        auto copyTime = measureCopyTime(msg, threadCount);
+        std::cout << threadCount << " threads copied and destroyed a message in " << copyTime << " ns on average" << '\n';
+    }
+}
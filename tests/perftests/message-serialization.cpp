@@ -0,0 +1,232 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file message-serialization.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Microbenchmarks of Message serialization and deserialization, per type family. Messages are created
+// on the pseudo connection, so no bus is needed. Run with `--benchmark_format=json` (or with
+// `--benchmark_out=<file> --benchmark_out_format=json`) to get results for comparison across changes.
+
+namespace bench {
+
+    struct Struct
+    {
+        int32_t i{};
+        std::string s;
+        std::vector<double> d;
+        bool b{};
+    };
+
+} // namespace bench
+
+SDBUSCPP_REGISTER_STRUCT(bench::Struct, i, s, d, b); // NOLINT(readability-identifier-length)
+
+namespace {
+
+constexpr std::size_t SHORT_STRING_SIZE = 16;
+constexpr std::size_t LONG_STRING_SIZE = 4096;
+constexpr std::size_t CONTAINER_SIZE = 256;
+
+using StringVector = std::vector<std::string>;
+using IntVector = std::vector<int32_t>;
+using DoubleVector = std::vector<double>;
+using IntToStringMap = std::map<int32_t, std::string>;
+using StringToIntUnorderedMap = std::unordered_map<std::string, int32_t>;
+using PropertyMap = std::map<std::string, sdbus::Variant>;
+using NestedContainer = std::vector<std::map<std::string, std::vector<int32_t>>>;
+using SdbusStruct = sdbus::Struct<int32_t, std::string, double>;
+
+const std::string shortString(SHORT_STRING_SIZE, 'x');
+const std::string longString(LONG_STRING_SIZE, 'x');
+
+template <typename Container, typename Generator>
+Container makeContainer(Generator generator)
+{
+    Container container;
+    for (std::size_t i = 0; i < CONTAINER_SIZE; ++i)
+        container.insert(container.end(), generator(static_cast<int32_t>(i)));
+    return container;
+}
+
+const auto intVector = makeContainer<IntVector>([](int32_t i){ return i; });
+const auto doubleVector = makeContainer<DoubleVector>([](int32_t i){ return i * 0.5; });
+const auto stringVector = makeContainer<StringVector>([](int32_t i){ return shortString + std::to_string(i); });
+const auto intToStringMap = makeContainer<IntToStringMap>([](int32_t i){ return std::pair{i, shortString}; });
+const auto stringToIntUnorderedMap = makeContainer<StringToIntUnorderedMap>([](int32_t i){ return std::pair{shortString + std::to_string(i), i}; });
+const PropertyMap propertyMap{ {"Name", sdbus::Variant{shortString}}
+                             , {"Enabled", sdbus::Variant{true}}
+                             , {"Count", sdbus::Variant{uint32_t{42}}}
+                             , {"Values", sdbus::Variant{doubleVector}} };
+const NestedContainer nestedContainer(16, {{"first", {1, 2, 3, 4}}, {"second", {5, 6, 7, 8}}, {"third", {9, 10}}});
+const SdbusStruct sdbusStruct{42, shortString, 3.14};
+const bench::Struct userStruct{42, shortString, {1.0, 2.0, 3.0}, true};
+
+// Creating (and sealing) a message is part of each serialization benchmark, this measures it alone
+void createEmptyMessage(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto msg = sdbus::createPlainMessage();
+        msg.seal();
+        benchmark::DoNotOptimize(msg);
+    }
+}
+
+template <typename Value>
+void serialize(benchmark::State& state, const Value& value)
+{
+    for (auto _ : state)
+    {
+        auto msg = sdbus::createPlainMessage();
+        msg << value;
+        msg.seal();
+        benchmark::DoNotOptimize(msg);
+    }
+}
+
+// Variants share their underlying message among copies, so each thread constructs its own one in each iteration
+void serializeFreshVariant(benchmark::State& state, const IntVector& value)
+{
+    for (auto _ : state)
+    {
+        sdbus::Variant variant{value};
+        auto msg = sdbus::createPlainMessage();
+        msg << variant;
+        msg.seal();
+        benchmark::DoNotOptimize(msg);
+    }
+}
+
+// Deserializes a value written in its serialized form as Read, from the same sealed message in each iteration
+template <typename Read, typename Written>
+void deserializeAs(benchmark::State& state, const Written& value)
+{
+    auto msg = sdbus::createPlainMessage();
+    msg << value;
+    msg.seal();
+
+    for (auto _ : state)
+    {
+        msg.rewind(true);
+        Read result;
+        msg >> result;
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+template <typename Value>
+void deserialize(benchmark::State& state, const Value& value)
+{
+    deserializeAs<Value>(state, value);
+}
+
+void deserializeStringView(benchmark::State& state, const std::string& value)
+{
+    deserializeAs<std::string_view>(state, value);
+}
+
+void deserializeStringViewVector(benchmark::State& state, const std::vector<std::string>& value)
+{
+    deserializeAs<std::vector<std::string_view>>(state, value);
+}
+
+void deserializeConstSpan(benchmark::State& state, const std::vector<double>& value)
+{
+    deserializeAs<std::span<const double>>(state, value);
+}
+
+void deserializeUserStruct(benchmark::State& state, const sdbus::as_dictionary<bench::Struct>& value)
+{
+    deserializeAs<bench::Struct>(state, value);
+}
+
+} // namespace
+
+BENCHMARK(createEmptyMessage);
+// Local messages of different threads are constructed on different pseudo connections, so this shall scale with threads
+BENCHMARK(createEmptyMessage)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_CAPTURE(serializeFreshVariant, int32_vector_variant, intVector)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_CAPTURE(serialize, bool, true);
+BENCHMARK_CAPTURE(deserialize, bool, true);
+BENCHMARK_CAPTURE(serialize, int32, int32_t{42});
+BENCHMARK_CAPTURE(deserialize, int32, int32_t{42});
+BENCHMARK_CAPTURE(serialize, uint64, uint64_t{42});
+BENCHMARK_CAPTURE(deserialize, uint64, uint64_t{42});
+BENCHMARK_CAPTURE(serialize, double, 3.14);
+BENCHMARK_CAPTURE(deserialize, double, 3.14);
+
+BENCHMARK_CAPTURE(serialize, short_string, shortString);
+BENCHMARK_CAPTURE(deserialize, short_string, shortString);
+BENCHMARK_CAPTURE(serialize, long_string, longString);
+BENCHMARK_CAPTURE(deserialize, long_string, longString);
+BENCHMARK_CAPTURE(serialize, short_string_view, std::string_view{shortString});
+BENCHMARK_CAPTURE(serialize, long_string_view, std::string_view{longString});
+BENCHMARK_CAPTURE(deserializeStringView, short_string, shortString);
+BENCHMARK_CAPTURE(deserializeStringView, long_string, longString);
+BENCHMARK_CAPTURE(serialize, object_path, sdbus::ObjectPath{"/org/sdbuscpp/perftests/object"});
+BENCHMARK_CAPTURE(deserialize, object_path, sdbus::ObjectPath{"/org/sdbuscpp/perftests/object"});
+
+BENCHMARK_CAPTURE(serialize, int32_vector, intVector);
+BENCHMARK_CAPTURE(deserialize, int32_vector, intVector);
+BENCHMARK_CAPTURE(serialize, double_vector, doubleVector);
+BENCHMARK_CAPTURE(deserialize, double_vector, doubleVector);
+BENCHMARK_CAPTURE(deserializeConstSpan, double_vector, doubleVector);
+BENCHMARK_CAPTURE(serialize, string_vector, stringVector);
+BENCHMARK_CAPTURE(deserialize, string_vector, stringVector);
+BENCHMARK_CAPTURE(deserializeStringViewVector, string_vector, stringVector);
+
+BENCHMARK_CAPTURE(serialize, int32_to_string_map, intToStringMap);
+BENCHMARK_CAPTURE(deserialize, int32_to_string_map, intToStringMap);
+BENCHMARK_CAPTURE(serialize, string_to_int32_unordered_map, stringToIntUnorderedMap);
+BENCHMARK_CAPTURE(deserialize, string_to_int32_unordered_map, stringToIntUnorderedMap);
+
+BENCHMARK_CAPTURE(serialize, struct, sdbusStruct);
+BENCHMARK_CAPTURE(deserialize, struct, sdbusStruct);
+BENCHMARK_CAPTURE(serialize, user_struct, userStruct);
+BENCHMARK_CAPTURE(deserialize, user_struct, userStruct);
+BENCHMARK_CAPTURE(serialize, user_struct_as_dictionary, sdbus::as_dictionary{userStruct});
+BENCHMARK_CAPTURE(deserializeUserStruct, from_dictionary, sdbus::as_dictionary{userStruct});
+
+BENCHMARK_CAPTURE(serialize, int32_variant, sdbus::Variant{int32_t{42}});
+BENCHMARK_CAPTURE(deserialize, int32_variant, sdbus::Variant{int32_t{42}});
+BENCHMARK_CAPTURE(serialize, string_variant, sdbus::Variant{shortString});
+BENCHMARK_CAPTURE(deserialize, string_variant, sdbus::Variant{shortString});
+BENCHMARK_CAPTURE(serialize, property_map, propertyMap);
+BENCHMARK_CAPTURE(deserialize, property_map, propertyMap);
+
+BENCHMARK_CAPTURE(serialize, nested_container, nestedContainer);
+BENCHMARK_CAPTURE(deserialize, nested_container, nestedContainer);
+
+BENCHMARK_MAIN();
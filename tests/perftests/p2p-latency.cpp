@@ -0,0 +1,288 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file p2p-latency.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures latency percentiles and throughput of method calls and signals over private peer-to-peer
+// connections on a socketpair, so no bus daemon (and no bus policy file) is needed.
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const sdbus::ObjectPath OBJECT_PATH{"/org/sdbuscpp/perftests/p2p"};
+const sdbus::InterfaceName INTERFACE_NAME{"org.sdbuscpp.perftests"};
+const sdbus::ServiceName NO_DESTINATION{}; // Peer-to-peer connections have no bus names
+
+constexpr std::size_t MAX_QUEUED_SIGNALS = 1024; // Keeps the signal flood from piling up in the outbound queue
+
+using Payload = std::vector<uint8_t>;
+using Latencies = std::vector<std::chrono::nanoseconds>;
+
+// Server and client connections on both ends of a socketpair, each running its own event loop thread
+struct Peers
+{
+    ~Peers()
+    {
+        // Either event loop would fail on the peer hanging up otherwise
+        serverConnection->leaveEventLoop();
+        clientConnection->leaveEventLoop();
+    }
+
+    std::unique_ptr<sdbus::IConnection> serverConnection;
+    std::unique_ptr<sdbus::IObject> object;
+    std::unique_ptr<sdbus::IConnection> clientConnection;
+    std::unique_ptr<sdbus::IProxy> proxy;
+};
+
+std::unique_ptr<Peers> createPeers()
+{
+    int fds[2]{}; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) < 0)
+        throw std::runtime_error("Failed to create socketpair");
+
+    auto peers = std::make_unique<Peers>();
+
+    // The server must be serving already, otherwise the client would wait for authentication forever
+    std::thread serverThread([&]()
+    {
+        peers->serverConnection = sdbus::createServerBus(fds[0]);
+        peers->serverConnection->enterEventLoopAsync();
+    });
+    peers->clientConnection = sdbus::createDirectBusConnection(fds[1]);
+    peers->clientConnection->enterEventLoopAsync();
+    serverThread.join();
+
+    peers->object = sdbus::createObject(*peers->serverConnection, OBJECT_PATH);
+    peers->object->addVTable( sdbus::registerMethod("echo").implementedAs([](Payload payload){ return payload; })
+                            , sdbus::registerSignal("tick").withParameters<uint64_t, Payload>() )
+                   .forInterface(INTERFACE_NAME);
+    peers->proxy = sdbus::createProxy(*peers->clientConnection, NO_DESTINATION, OBJECT_PATH);
+
+    return peers;
+}
+
+uint64_t nowInNanoseconds()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+struct Result
+{
+    Latencies latencies;
+    std::chrono::nanoseconds wallTime{};
+};
+
+// Runs the given workload in each client thread at once, thread i working with peers i (modulo number of peers)
+Result runClients(const std::vector<std::unique_ptr<Peers>>& peers, std::size_t threadCount, const std::function<Latencies(Peers&)>& workload)
+{
+    std::vector<std::future<Latencies>> clients;
+    auto startTime = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < threadCount; ++i)
+        clients.push_back(std::async(std::launch::async, workload, std::ref(*peers[i % peers.size()])));
+
+    Result result;
+    for (auto& client : clients)
+    {
+        auto latencies = client.get();
+        result.latencies.insert(result.latencies.end(), latencies.begin(), latencies.end());
+    }
+    result.wallTime = std::chrono::steady_clock::now() - startTime;
+    return result;
+}
+
+// Each call is made only after the reply to the previous one has arrived
+Latencies pingPong(Peers& peers, const Payload& payload, std::size_t operations)
+{
+    Latencies latencies;
+    latencies.reserve(operations);
+    for (std::size_t i = 0; i < operations; ++i)
+    {
+        Payload reply;
+        auto sendTime = std::chrono::steady_clock::now();
+        peers.proxy->callMethod("echo").onInterface(INTERFACE_NAME).withArguments(payload).storeResultsTo(reply);
+        latencies.push_back(std::chrono::steady_clock::now() - sendTime);
+    }
+    return latencies;
+}
+
+// Keeps the given number of asynchronous calls in flight, a next call is made from the reply handler of a previous one
+Latencies pipelinedCalls(Peers& peers, const Payload& payload, std::size_t operations, std::size_t depth)
+{
+    Latencies latencies;
+    latencies.reserve(operations);
+    std::atomic<std::size_t> issued{};
+    std::promise<void> done;
+
+    std::function<void()> call = [&]()
+    {
+        if (issued++ >= operations)
+            return;
+
+        auto sendTime = std::chrono::steady_clock::now();
+        peers.proxy->callMethodAsync("echo")
+                     .onInterface(INTERFACE_NAME)
+                     .withArguments(payload)
+                     .uponReplyInvoke([&, sendTime](std::optional<sdbus::Error> error, const Payload& /*reply*/)
+                     {
+                         latencies.push_back(std::chrono::steady_clock::now() - sendTime);
+                         if (error)
+                             std::cerr << "Pipelined call failed: " << error->getMessage() << '\n';
+                         if (latencies.size() == operations)
+                             done.set_value();
+                         else
+                             call();
+                     });
+    };
+
+    for (std::size_t i = 0; i < std::min(depth, operations); ++i)
+        call();
+    done.get_future().wait();
+    return latencies;
+}
+
+// Signal latencies are measured on the receiving side, from the timestamp carried in the signal
+struct SignalReceiver
+{
+    Latencies latencies;
+    std::size_t expected{};
+    std::promise<void> done;
+};
+
+Latencies signalFlood(Peers& peers, const Payload& payload, std::size_t operations)
+{
+    for (std::size_t i = 0; i < operations; ++i)
+    {
+        while (peers.serverConnection->getOutboundQueueLength() >= MAX_QUEUED_SIGNALS)
+            std::this_thread::yield();
+        peers.object->emitSignal("tick").onInterface(INTERFACE_NAME).withArguments(nowInNanoseconds(), payload);
+    }
+    return {};
+}
+
+Result measureSignalFlood(const std::vector<std::unique_ptr<Peers>>& peers, const Payload& payload, std::size_t threadCount, std::size_t operations)
+{
+    std::vector<SignalReceiver> receivers(peers.size());
+    for (std::size_t i = 0; i < peers.size(); ++i)
+    {
+        auto& receiver = receivers[i];
+        receiver.expected = operations * (threadCount / peers.size() + (i < threadCount % peers.size() ? 1 : 0));
+        receiver.latencies.reserve(receiver.expected);
+        peers[i]->proxy->uponSignal("tick").onInterface(INTERFACE_NAME).call([&receiver](uint64_t sendTime, const Payload& /*payload*/)
+        {
+            receiver.latencies.emplace_back(nowInNanoseconds() - sendTime);
+            if (receiver.latencies.size() == receiver.expected)
+                receiver.done.set_value();
+        });
+    }
+
+    auto result = runClients(peers, threadCount, [&](Peers& p){ return signalFlood(p, payload, operations); });
+    for (auto& receiver : receivers)
+    {
+        receiver.done.get_future().wait();
+        result.latencies.insert(result.latencies.end(), receiver.latencies.begin(), receiver.latencies.end());
+    }
+    for (const auto& p : peers)
+        p->proxy->unregister();
+
+    return result;
+}
+
+void printResult(const std::string& label, Result result)
+{
+    if (result.latencies.empty())
+        return;
+
+    std::sort(result.latencies.begin(), result.latencies.end());
+    auto percentile = [&](double p)
+    {
+        auto index = std::min(static_cast<std::size_t>(p / 100.0 * static_cast<double>(result.latencies.size())), result.latencies.size() - 1);
+        return std::chrono::duration<double, std::micro>(result.latencies[index]).count();
+    };
+    auto throughput = static_cast<double>(result.latencies.size()) / std::chrono::duration<double>(result.wallTime).count();
+
+    std::cout << "  " << label << ": p50 " << percentile(50) << " us, p90 " << percentile(90) << " us"
+              << ", p99 " << percentile(99) << " us, p99.9 " << percentile(99.9) << " us"
+              << ", throughput " << static_cast<uint64_t>(throughput) << " ops/s" << '\n';
+}
+
+std::vector<std::size_t> parseSizes(const std::string& list)
+{
+    std::vector<std::size_t> sizes;
+    std::istringstream stream(list);
+    for (std::string size; std::getline(stream, size, ',');)
+        sizes.push_back(std::stoul(size));
+    return sizes;
+}
+
+} // namespace
+
+//-----------------------------------------
+int main(int argc, char *argv[])
+{
+    // Optional arguments: comma-separated payload sizes in bytes, number of client threads, number of operations
+    // per client thread, and number of asynchronous calls in flight per client thread in the pipelined scenario
+    auto const payloadSizes = parseSizes(argc > 1 ? argv[1] : "64,4096,65536"); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::size_t const threadCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::size_t const operations = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 20'000; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::size_t const depth = argc > 4 ? std::strtoul(argv[4], nullptr, 10) : 16; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    // All client threads share a single pair of connections first, then each client thread gets a pair of its own
+    std::vector<std::vector<std::unique_ptr<Peers>>> setups(threadCount > 1 ? 2 : 1);
+    setups[0].push_back(createPeers());
+    for (std::size_t i = 0; threadCount > 1 && i < threadCount; ++i)
+        setups[1].push_back(createPeers());
+
+    for (auto payloadSize : payloadSizes)
+    {
+        const Payload payload(payloadSize, 'x');
+        for (const auto& peers : setups)
+        {
+            std::cout << threadCount << " client thread(s) over " << peers.size() << " connection pair(s), "
+                      << operations << " operations per thread, " << payloadSize << " B payload:" << '\n';
+
+            printResult("Ping-pong calls", runClients(peers, threadCount, [&](Peers& p){ return pingPong(p, payload, operations); }));
+            printResult("Pipelined async calls (" + std::to_string(depth) + " in flight)"
+                       , runClients(peers, threadCount, [&](Peers& p){ return pipelinedCalls(p, payload, operations, depth); }));
+            printResult("Signal flood", measureSignalFlood(peers, payload, threadCount, operations));
+        }
+    }
+}
@@ -0,0 +1,150 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file ping-pong.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+const sdbus::ServiceName SERVICE_NAME{"org.sdbuscpp.perftests"};
+const sdbus::ObjectPath OBJECT_PATH{"/org/sdbuscpp/perftests/pingpong"};
+const sdbus::InterfaceName INTERFACE_NAME{"org.sdbuscpp.perftests"};
+
+struct Measurement
+{
+    std::chrono::nanoseconds median;
+    std::chrono::nanoseconds p99;
+    std::chrono::nanoseconds mean;
+    double cpuLoad; // Number of CPU cores kept busy by the process on average
+};
+
+std::chrono::microseconds getCpuTime()
+{
+    rusage usage{};
+    (void)getrusage(RUSAGE_SELF, &usage);
+    auto toDuration = [](const timeval& tv){ return std::chrono::seconds{tv.tv_sec} + std::chrono::microseconds{tv.tv_usec}; };
+    return toDuration(usage.ru_utime) + toDuration(usage.ru_stime);
+}
+
+// Bounces a method call back and forth between a client and a server connection, each running its own event loop
+// thread, and measures the round-trip times. A next call is only made from the reply handler of the previous one.
+Measurement measurePingPong(std::size_t roundTrips, std::chrono::microseconds busyPollWindow, sdbus::IConnection::EventLoopBackend backend)
+{
+    auto serverConnection = sdbus::createSystemBusConnection(SERVICE_NAME);
+    serverConnection->setEventLoopBackend(backend);
+    serverConnection->setBusyPollWindow(busyPollWindow);
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("ping").implementedAs([](uint64_t token){ return token; })).forInterface(INTERFACE_NAME);
+    serverConnection->enterEventLoopAsync();
+
+    auto clientConnection = sdbus::createSystemBusConnection();
+    clientConnection->setEventLoopBackend(backend);
+    clientConnection->setBusyPollWindow(busyPollWindow);
+    auto proxy = sdbus::createProxy(*clientConnection, SERVICE_NAME, OBJECT_PATH);
+    clientConnection->enterEventLoopAsync();
+
+    std::vector<std::chrono::nanoseconds> roundTripTimes;
+    roundTripTimes.reserve(roundTrips);
+    std::promise<void> done;
+    std::chrono::steady_clock::time_point sendTime;
+    std::function<void()> ping = [&]()
+    {
+        sendTime = std::chrono::steady_clock::now();
+        (void)proxy->callMethodAsync("ping")
+                    .onInterface(INTERFACE_NAME)
+                    .withArguments(uint64_t{roundTripTimes.size()})
+                    .uponReplyInvoke([&](std::optional<sdbus::Error> error, uint64_t /*token*/)
+                    {
+                        roundTripTimes.push_back(std::chrono::steady_clock::now() - sendTime);
+                        if (error || roundTripTimes.size() == roundTrips)
+                            done.set_value();
+                        else
+                            ping();
+                    });
+    };
+
+    auto startCpuTime = getCpuTime();
+    auto startTime = std::chrono::steady_clock::now();
+    ping();
+    done.get_future().wait();
+    auto wallTime = std::chrono::steady_clock::now() - startTime;
+    auto cpuTime = getCpuTime() - startCpuTime;
+
+    std::sort(roundTripTimes.begin(), roundTripTimes.end());
+    Measurement result{};
+    result.median = roundTripTimes[roundTripTimes.size() / 2];
+    result.p99 = roundTripTimes[roundTripTimes.size() * 99 / 100];
+    result.mean = std::chrono::duration_cast<std::chrono::nanoseconds>(wallTime) / roundTripTimes.size();
+    result.cpuLoad = std::chrono::duration<double>(cpuTime) / std::chrono::duration<double>(wallTime);
+    return result;
+}
+
+void printMeasurement(const std::string& label, const Measurement& measurement)
+{
+    auto toMicroseconds = [](std::chrono::nanoseconds ns){ return std::chrono::duration<double, std::micro>(ns).count(); };
+    std::cout << label << ": round trip median " << toMicroseconds(measurement.median) << " us"
+              << ", p99 " << toMicroseconds(measurement.p99) << " us"
+              << ", mean " << toMicroseconds(measurement.mean) << " us"
+              << ", CPU load " << measurement.cpuLoad << " cores" << '\n';
+}
+
+} // namespace
+
+//-----------------------------------------
+int main(int argc, char *argv[])
+{
+    // Optional arguments: number of round trips, busy-poll window in microseconds, and event loop backend (epoll or io_uring)
+    std::size_t const roundTrips = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100'000; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::chrono::microseconds const busyPollWindow{argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200}; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    bool const useIoUring = argc > 3 && std::string{argv[3]} == "io_uring"; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto const backend = useIoUring ? sdbus::IConnection::EventLoopBackend::IoUring : sdbus::IConnection::EventLoopBackend::Epoll;
+    if (roundTrips == 0)
+    {
+        std::cerr << "The number of round trips must be a positive number" << '\n';
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Measuring " << roundTrips << " method call round trips..." << '\n';
+
+    auto sleeping = measurePingPong(roundTrips, 0us, backend);
+    printMeasurement("Sleeping in poll", sleeping);
+
+    auto busyPolling = measurePingPong(roundTrips, busyPollWindow, backend);
+    printMeasurement("Busy polling for " + std::to_string(busyPollWindow.count()) + " us", busyPolling);
+}
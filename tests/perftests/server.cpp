@@ -25,6 +25,7 @@
  */
 
 #include "perftests-adaptor.h"
+#include "SyscallCounter.h"
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -43,8 +44,10 @@ std::string createRandomString(size_t length);
 class PerftestAdaptor final : public sdbus::AdaptorInterfaces<org::sdbuscpp::perftests_adaptor>
 {
 public:
-    PerftestAdaptor(sdbus::IConnection& connection, sdbus::ObjectPath objectPath)
+    PerftestAdaptor(sdbus::IConnection& connection, sdbus::ObjectPath objectPath, uint32_t signalBatchSize)
         : AdaptorInterfaces(connection, std::move(objectPath))
+        , connection_(connection)
+        , signalBatchSize_(signalBatchSize)
     {
         registerAdaptor();
     }
@@ -64,20 +67,41 @@ protected:
     {
         auto data = createRandomString(signalMsgSize);
 
+        SyscallCounter syscallCounter;
+        syscallCounter.start();
         auto start_time = std::chrono::steady_clock::now();
-        for (uint32_t i = 0; i < numberOfSignals; ++i)
+        for (uint32_t i = 0; i < numberOfSignals; i += signalBatchSize_)
         {
-            // Emit signal
-            emitDataSignal(data);
+            // Signals emitted under a cork are sent in one batch when the cork is released
+            auto cork = signalBatchSize_ > 1 ? connection_.cork() : sdbus::Slot{};
+            for (uint32_t j = i; j < std::min(numberOfSignals, i + signalBatchSize_); ++j)
+                emitDataSignal(data);
         }
         auto stop_time = std::chrono::steady_clock::now();
-        std::cout << "Server sent " << numberOfSignals << " signals in: " << std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count() << " ms" << '\n';
+        auto syscalls = syscallCounter.stop();
+        std::cout << "Server sent " << numberOfSignals << " signals in: " << std::chrono::duration_cast<std::chrono::milliseconds>(stop_time - start_time).count() << " ms";
+        if (syscallCounter.isAvailable())
+            std::cout << " (" << static_cast<double>(syscalls) / numberOfSignals << " syscalls per signal)";
+        std::cout << '\n';
     }
 
     std::string concatenateTwoStrings(const std::string& string1, const std::string& string2) override
     {
         return string1 + string2;
     }
+
+    uint32_t computeChecksum(const uint32_t& seed, const uint32_t& rounds) override // NOLINT(bugprone-easily-swappable-parameters)
+    {
+        // Simulates a CPU-bound handler (FNV-1a-like mixing)
+        uint32_t checksum = seed ^ 2166136261U;
+        for (uint32_t i = 0; i < rounds; ++i)
+            checksum = (checksum ^ i) * 16777619U;
+        return checksum;
+    }
+
+private:
+    sdbus::IConnection& connection_;
+    uint32_t signalBatchSize_;
 };
 
 std::string createRandomString(size_t length)
@@ -103,13 +127,25 @@ std::string createRandomString(size_t length)
 
 
 //-----------------------------------------
-int main(int /*argc*/, char */*argv*/[])
+int main(int argc, char *argv[])
 {
+    // Optional arguments: number of worker threads to dispatch method calls to (0 means the event loop thread),
+    // event loop backend (epoll or io_uring), and number of data signals sent in one batch
+    std::size_t const dispatchThreadCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 0; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    bool const useIoUring = argc > 2 && std::string{argv[2]} == "io_uring"; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto const signalBatchSize = std::max<uint32_t>(argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1, 1); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
     sdbus::ServiceName const serviceName{"org.sdbuscpp.perftests"};
     auto connection = sdbus::createSystemBusConnection(serviceName);
+    connection->setDispatchThreadCount(dispatchThreadCount);
+    if (useIoUring)
+        connection->setEventLoopBackend(sdbus::IConnection::EventLoopBackend::IoUring);
+    std::cout << "Dispatching method calls to " << dispatchThreadCount << " worker threads" << '\n';
+    std::cout << "Sending data signals in batches of " << signalBatchSize << '\n';
+    std::cout << "Using " << (connection->getEventLoopBackend() == sdbus::IConnection::EventLoopBackend::IoUring ? "io_uring" : "epoll") << " event loop backend" << '\n';
 
     sdbus::ObjectPath objectPath{"/org/sdbuscpp/perftests"};
-    PerftestAdaptor server(*connection, std::move(objectPath)); // NOLINT(misc-const-correctness)
+    PerftestAdaptor server(*connection, std::move(objectPath), signalBatchSize); // NOLINT(misc-const-correctness)
 
     connection->enterEventLoop();
 }
@@ -50,6 +50,7 @@
 #include <map>
 #include <optional>
 #include <stdexcept>
+#include <functional>
 
 using namespace std::chrono_literals;
 
@@ -385,21 +386,28 @@ int main(int argc, char *argv[]) // NOLINT(bugprone-exception-escape, readabilit
 {
     long loops{};
     long loopDuration{};
+    long clientShards{1};
 
     if (argc == 1)
     {
         loops = 1;
         loopDuration = 30000;
     }
-    else if (argc == 3)
+    else if (argc == 3 || argc == 4)
     {
         loops = std::atol(argv[1]); // NOLINT(cert-err34-c, cppcoreguidelines-pro-bounds-pointer-arithmetic)
         loopDuration = std::atol(argv[2]); // NOLINT(cert-err34-c, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (argc == 4)
+            clientShards = std::atol(argv[3]); // NOLINT(cert-err34-c, cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
     else
         throw std::runtime_error("Wrong program options");
 
-    std::cout << "Going on with " << loops << " loops and " << loopDuration << "ms loop duration\n";
+    if (clientShards < 1)
+        throw std::runtime_error("Wrong number of client connection shards");
+
+    std::cout << "Going on with " << loops << " loops and " << loopDuration << "ms loop duration, "
+              << clientShards << " client connection shards\n";
 
     std::atomic<uint32_t> concatenationCallsMade{0};
     std::atomic<uint32_t> concatenationRepliesReceived{0};
@@ -448,19 +456,23 @@ int main(int argc, char *argv[]) // NOLINT(bugprone-exception-escape, readabilit
         while (!service2ThreadReady || !service1ThreadReady)
             std::this_thread::sleep_for(1ms);
 
-        auto clientConnection = sdbus::createSystemBusConnection();
+        // Concatenator clients, one per shard, each flood the service over their own connection
+        sdbus::ConnectionPool clientConnections(static_cast<std::size_t>(clientShards), [](){ return sdbus::createSystemBusConnection(); });
         std::mutex clientThreadExitMutex;
         std::condition_variable clientThreadExitCond;
         bool clientThreadExit{};
-        std::thread clientThread([&, &con = *clientConnection]()
+        std::thread clientThread([&]()
         {
             std::atomic stopClients{false};
 
-            std::thread concatenatorThread([&]()
+            auto runConcatenatorClient = [&](sdbus::IConnection& con)
             {
                 ConcatenatorProxy concatenator(con, SERVICE_1_BUS_NAME, CONCATENATOR_OBJECT_PATH);
 
                 uint32_t localCounter{};
+                uint32_t reportedCalls{};
+                uint32_t reportedReplies{};
+                uint32_t reportedSignals{};
 
                 // Issue async concatenate calls densely one after another
                 while (!stopClients)
@@ -479,15 +491,24 @@ int main(int argc, char *argv[]) // NOLINT(bugprone-exception-escape, readabilit
                         while ((localCounter - concatenator.repliesReceived_) > 40 && !stopClients)
                             std::this_thread::sleep_for(1ms);
 
-                        // Update statistics
-                        concatenationCallsMade = localCounter;
-                        concatenationRepliesReceived = static_cast<uint32_t>(concatenator.repliesReceived_);
-                        concatenationSignalsReceived = static_cast<uint32_t>(concatenator.signalsReceived_);
+                        // Update statistics, summed up over all concatenator clients
+                        auto repliesReceived = static_cast<uint32_t>(concatenator.repliesReceived_);
+                        auto signalsReceived = static_cast<uint32_t>(concatenator.signalsReceived_);
+                        concatenationCallsMade += localCounter - reportedCalls;
+                        concatenationRepliesReceived += repliesReceived - reportedReplies;
+                        concatenationSignalsReceived += signalsReceived - reportedSignals;
+                        reportedCalls = localCounter;
+                        reportedReplies = repliesReceived;
+                        reportedSignals = signalsReceived;
                     }
                 }
-            });
+            };
+
+            std::vector<std::thread> concatenatorThreads;
+            for (std::size_t shard = 0; shard < clientConnections.size(); ++shard)
+                concatenatorThreads.emplace_back(runConcatenatorClient, std::ref(clientConnections.getConnection(shard)));
 
-            std::thread thermometerThread([&]()
+            std::thread thermometerThread([&, &con = clientConnections.getConnectionFor(FAHRENHEIT_THERMOMETER_OBJECT_PATH)]()
             {
                 // Here we continuously remotely call getCurrentTemperature(). We have one proxy object,
                 // first we use it's factory interface to create another proxy object, call getCurrentTemperature()
@@ -517,17 +538,17 @@ int main(int argc, char *argv[]) // NOLINT(bugprone-exception-escape, readabilit
                 }
             });
 
-            // We could run the loop in a sync way, but we want it to run also when proxies are destroyed for better
-            // coverage of multi-threaded scenarios, so we run it async and use condition variable for exit notification
-            //con.enterEventLoop();
-            con.enterEventLoopAsync();
+            // We could run the loops in a sync way, but we want them to run also when proxies are destroyed for better
+            // coverage of multi-threaded scenarios, so we run them async and use condition variable for exit notification
+            clientConnections.enterEventLoopsAsync();
 
             std::unique_lock<std::mutex> lock(clientThreadExitMutex);
             clientThreadExitCond.wait(lock, [&]{return clientThreadExit;});
 
             stopClients = true;
             thermometerThread.join();
-            concatenatorThread.join();
+            for (auto& concatenatorThread : concatenatorThreads)
+                concatenatorThread.join();
         });
 
         std::this_thread::sleep_for(std::chrono::milliseconds(loopDuration));
@@ -0,0 +1,69 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file DispatchWatchdog_test.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DispatchWatchdog.h"
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <future>
+#include SDBUS_HEADER
+
+using ::testing::Eq;
+using ::testing::Ge;
+using sdbus::internal::DispatchWatchdog;
+using namespace std::chrono_literals;
+
+/*-------------------------------------*/
+/* --          TEST CASES           -- */
+/*-------------------------------------*/
+
+TEST(ADispatchWatchdog, ReportsStalledDispatchWhoseMessageIsGoneAlready)
+{
+    DispatchWatchdog watchdog;
+    std::promise<DispatchWatchdog::Stall> reportedStall;
+    watchdog.configure(10ms, [&](const DispatchWatchdog::Stall& stall){ reportedStall.set_value(stall); });
+    sd_bus* bus{};
+    ASSERT_THAT(sd_bus_new(&bus), Ge(0));
+    (void)sd_bus_start(bus); // Makes a local bus, like that of a pseudo connection, able to create messages
+    sd_bus_message* sdbusMsg{};
+    ASSERT_THAT(sd_bus_message_new_method_call(bus, &sdbusMsg, "org.sdbuscpp.test", "/org/sdbuscpp/test", "org.sdbuscpp.Test", "slowPing"), Ge(0));
+
+    watchdog.dispatchStarted(sdbusMsg, std::chrono::steady_clock::now());
+    // sd-bus unreferences the message when done with it, which is before the dispatch is finished for the watchdog
+    sd_bus_message_unref(sdbusMsg);
+    sd_bus_unref(bus);
+
+    auto stallFuture = reportedStall.get_future();
+    ASSERT_THAT(stallFuture.wait_for(1s), Eq(std::future_status::ready));
+    watchdog.dispatchFinished();
+    auto stall = stallFuture.get();
+    ASSERT_THAT(stall.interfaceName, Eq("org.sdbuscpp.Test"));
+    ASSERT_THAT(stall.memberName, Eq("slowPing"));
+    ASSERT_THAT(stall.objectPath, Eq("/org/sdbuscpp/test"));
+    ASSERT_THAT(stall.duration, Ge(10ms));
+    ASSERT_THAT(watchdog.getStallCounts().at("org.sdbuscpp.Test.slowPing"), Eq(1U));
+}
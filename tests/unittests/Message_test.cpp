@@ -31,16 +31,21 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <array>
+#include <barrier>
 #include <cstdint>
+#include <filesystem>
 #include <list>
 #include <map>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <variant>
 #include <vector>
 
 using ::testing::Eq;
+using ::testing::Ne;
 using ::testing::StrEq;
 using ::testing::Gt;
 using ::testing::IsNull;
@@ -187,6 +192,113 @@ TEST(AMessage, CreatesShallowCopyWhenCopyConstructed)
     ASSERT_THROW(msgCopy >> str, sdbus::Error);
 }
 
+TEST(AMessage, StaysValidWhenOriginalIsDestroyedBeforeItsCopy)
+{
+    std::optional<sdbus::PlainMessage> msg = sdbus::createPlainMessage();
+    *msg << "I am a string"s;
+    msg->seal();
+
+    sdbus::PlainMessage msgCopy = *msg;
+    msg.reset();
+
+    ASSERT_TRUE(msgCopy.isValid());
+    ASSERT_THAT(deserializeString(msgCopy), Eq("I am a string"));
+}
+
+TEST(AMessage, CanBeCopiedAndDestroyedConcurrentlyFromMultipleThreads)
+{
+    auto msg = sdbus::createPlainMessage();
+    msg << "I am a string"s;
+    msg.seal();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&msg]()
+        {
+            for (int j = 0; j < 10000; ++j)
+            {
+                sdbus::PlainMessage msgCopy = msg;
+                sdbus::PlainMessage msgMovedCopy = std::move(msgCopy);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_TRUE(msg.isValid());
+    ASSERT_THAT(deserializeString(msg), Eq("I am a string"));
+}
+
+TEST(AMessage, StaysValidWhenTheThreadThatCreatedItHasExited)
+{
+    std::optional<sdbus::PlainMessage> msg;
+    std::thread([&msg]()
+    {
+        msg = sdbus::createPlainMessage();
+        *msg << "I am a string"s;
+        msg->seal();
+    }).join();
+
+    std::optional<sdbus::PlainMessage> msgOfAnotherThread;
+    std::thread([&msgOfAnotherThread]()
+    {
+        msgOfAnotherThread = sdbus::createPlainMessage(); // Possibly on the pseudo connection left over by the previous thread
+        *msgOfAnotherThread << "I am another string"s;
+        msgOfAnotherThread->seal();
+    }).join();
+
+    ASSERT_THAT(deserializeString(*msg), Eq("I am a string"));
+    ASSERT_THAT(deserializeString(*msgOfAnotherThread), Eq("I am another string"));
+}
+
+TEST(AMessage, OpensNoFileDescriptorsWhenCreatedInNewThreads)
+{
+    auto countOpenFds = []()
+    {
+        auto dir = std::filesystem::directory_iterator("/proc/self/fd");
+        return std::distance(begin(dir), end(dir));
+    };
+    const auto fdsBefore = countOpenFds();
+
+    // Concurrent threads each get a pseudo connection of their own. There are more of them than in other tests,
+    // so that some of these connections are newly created rather than reused ones.
+    std::vector<std::thread> threads;
+    std::barrier allThreadsHaveMessages(16);
+    for (int i = 0; i < 16; ++i)
+        threads.emplace_back([&]()
+        {
+            auto msg = sdbus::createPlainMessage();
+            msg << "I am a string"s;
+            allThreadsHaveMessages.arrive_and_wait();
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_THAT(countOpenFds(), Eq(fdsBefore));
+}
+
+TEST(AMessage, CanBeCreatedInOneThreadAndDestroyedInAnotherWhileBothCreateMessages)
+{
+    std::vector<sdbus::PlainMessage> messages;
+    for (int i = 0; i < 10000; ++i)
+        messages.push_back(sdbus::createPlainMessage());
+
+    std::thread destroyer([messages = std::move(messages)]() mutable
+    {
+        while (!messages.empty())
+        {
+            messages.pop_back();
+            (void)sdbus::createPlainMessage();
+        }
+    });
+    for (int i = 0; i < 10000; ++i)
+        (void)sdbus::createPlainMessage();
+    destroyer.join();
+
+    ASSERT_TRUE(sdbus::createPlainMessage().isValid());
+}
+
 TEST(AMessage, CreatesDeepCopyWhenEplicitlyCopied)
 {
     auto msg = sdbus::createPlainMessage();
@@ -247,6 +359,42 @@ TEST(AMessage, CanCarryAStringAsAStringView)
     ASSERT_THAT(dataRead, Eq(dataWritten));
 }
 
+TEST(AMessage, CanBeDeserializedIntoAStringViewPointingIntoTheMessage)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::string dataWritten = "Hello";
+
+    msg << dataWritten;
+    msg.seal();
+
+    std::string_view dataRead;
+    msg >> dataRead;
+    // Reading the string as a raw C string yields sd-bus' pointer into the message body
+    msg.rewind(true);
+    char* dataInMessage{};
+    msg >> dataInMessage;
+
+    ASSERT_THAT(dataRead, Eq(dataWritten));
+    ASSERT_THAT(dataRead.data(), Eq(dataInMessage));
+    ASSERT_THAT(dataRead.data(), Ne(dataWritten.data()));
+}
+
+TEST(AMessage, CanBeDeserializedIntoAVectorOfStringViews)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::vector<std::string> dataWritten{"a", "", "bcd"};
+
+    msg << dataWritten;
+    msg.seal();
+
+    std::vector<std::string_view> dataRead;
+    msg >> dataRead;
+
+    ASSERT_THAT(dataRead, ElementsAre("a", "", "bcd"));
+}
+
 TEST(AMessage, CanCarryAUnixFd)
 {
     auto msg = sdbus::createPlainMessage();
@@ -262,6 +410,54 @@ TEST(AMessage, CanCarryAUnixFd)
     ASSERT_THAT(dataRead.get(), Gt(dataWritten.get()));
 }
 
+TEST(AMessage, CanCarryASharedBufferInline)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::string data = "Hello";
+
+    msg << sdbus::SharedBuffer{data.data(), data.size()};
+    msg.seal();
+
+    sdbus::SharedBuffer dataRead;
+    msg >> dataRead;
+
+    ASSERT_FALSE(dataRead.isShared());
+    ASSERT_THAT(std::string(reinterpret_cast<const char*>(dataRead.data()), dataRead.size()), Eq(data));
+}
+
+TEST(AMessage, CanCarryASharedBufferInAMemfd)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::string data(1024, 'x');
+    const sdbus::SharedBuffer dataWritten{data.data(), data.size(), 1};
+
+    msg << dataWritten;
+    msg.seal();
+
+    sdbus::SharedBuffer dataRead;
+    msg >> dataRead;
+
+    ASSERT_TRUE(dataRead.isShared());
+    ASSERT_THAT(std::string(reinterpret_cast<const char*>(dataRead.data()), dataRead.size()), Eq(data));
+}
+
+TEST(AMessage, CanCarryAnArrayOfSharedBuffers)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    msg << std::vector{sdbus::SharedBuffer{"ab", 2, 1}, sdbus::SharedBuffer{"cde", 3}};
+    msg.seal();
+
+    std::vector<sdbus::SharedBuffer> dataRead;
+    msg >> dataRead;
+
+    ASSERT_THAT(dataRead, SizeIs(2));
+    ASSERT_TRUE(dataRead[0].isShared());
+    ASSERT_THAT(dataRead[1].size(), Eq(3U));
+}
+
 TEST(AMessage, CanCarryAVariant)
 {
     auto msg = sdbus::createPlainMessage();
@@ -388,6 +584,35 @@ TEST(AMessage, CanCarryDBusArrayOfNontrivialTypesGivenAsStdSpan)
 
     ASSERT_THAT(std::vector(dataRead.begin(), dataRead.end()), Eq(std::vector(dataWritten.begin(), dataWritten.end())));
 }
+
+TEST(AMessage, CanBeDeserializedIntoAStdSpanOfConstTrivialElementsPointingIntoTheMessage)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::vector<double> dataWritten{3.14, 2.71, -1.0};
+
+    msg << dataWritten;
+    msg.seal();
+
+    std::span<const double> dataRead;
+    msg >> dataRead;
+
+    ASSERT_THAT(std::vector(dataRead.begin(), dataRead.end()), Eq(dataWritten));
+    ASSERT_THAT(dataRead.data(), Ne(dataWritten.data()));
+}
+
+TEST(AMessage, CanBeDeserializedIntoAnEmptyStdSpanOfConstTrivialElements)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    msg << std::vector<uint8_t>{};
+    msg.seal();
+
+    std::span<const uint8_t> dataRead;
+    msg >> dataRead;
+
+    ASSERT_TRUE(dataRead.empty());
+}
 #endif
 
 TEST(AMessage, CanCarryAnEnumValue)
@@ -435,6 +660,19 @@ TEST(AMessage, ThrowsWhenDestinationStdSpanIsTooSmallDuringDeserialization)
     std::span dataRead{destinationArray};
     ASSERT_THROW(msg >> dataRead, sdbus::Error);
 }
+
+TEST(AMessage, ThrowsWhenExtentOfDestinationStdSpanOfConstElementsDoesNotMatchDuringDeserialization)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::array<int, 3> dataWritten{3545342, 43643532, 324325};
+
+    msg << dataWritten;
+    msg.seal();
+
+    std::span<const int, 2> dataRead{dataWritten.data(), 2};
+    ASSERT_THROW(msg >> dataRead, sdbus::Error);
+}
 #endif
 
 TEST(AMessage, CanCarryADictionary)
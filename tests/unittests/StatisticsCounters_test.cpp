@@ -0,0 +1,109 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file StatisticsCounters_test.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatisticsCounters.h"
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <numeric>
+#include SDBUS_HEADER
+
+using ::testing::Eq;
+using sdbus::internal::StatisticsCounters;
+using namespace std::chrono_literals;
+
+/*-------------------------------------*/
+/* --          TEST CASES           -- */
+/*-------------------------------------*/
+
+TEST(StatisticsCounters, StartsWithAllCountersAtZero)
+{
+    StatisticsCounters counters;
+
+    auto statistics = counters.snapshot();
+
+    ASSERT_THAT(statistics.received.methodCalls, Eq(0U));
+    ASSERT_THAT(statistics.sent.signals, Eq(0U));
+    ASSERT_THAT(statistics.pollWakeups, Eq(0U));
+    ASSERT_THAT(statistics.handlerTime, Eq(0ns));
+    ASSERT_THAT(std::accumulate(statistics.dispatchLatency.begin(), statistics.dispatchLatency.end(), uint64_t{}), Eq(0U));
+}
+
+TEST(StatisticsCounters, CountsMessagesPerType)
+{
+    StatisticsCounters counters;
+
+    counters.recordReceived(SD_BUS_MESSAGE_METHOD_CALL);
+    counters.recordReceived(SD_BUS_MESSAGE_METHOD_CALL);
+    counters.recordReceived(SD_BUS_MESSAGE_SIGNAL);
+    counters.recordSent(SD_BUS_MESSAGE_METHOD_RETURN);
+    counters.recordSent(SD_BUS_MESSAGE_METHOD_ERROR);
+
+    auto statistics = counters.snapshot();
+    ASSERT_THAT(statistics.received.methodCalls, Eq(2U));
+    ASSERT_THAT(statistics.received.signals, Eq(1U));
+    ASSERT_THAT(statistics.received.methodReplies, Eq(0U));
+    ASSERT_THAT(statistics.sent.methodReplies, Eq(1U));
+    ASSERT_THAT(statistics.sent.methodErrors, Eq(1U));
+}
+
+TEST(StatisticsCounters, PutsDurationsIntoLogScaleHistogramBuckets)
+{
+    ASSERT_THAT(StatisticsCounters::histogramBucket(500ns), Eq(0U));
+    ASSERT_THAT(StatisticsCounters::histogramBucket(1us), Eq(1U));
+    ASSERT_THAT(StatisticsCounters::histogramBucket(3us), Eq(2U));
+    ASSERT_THAT(StatisticsCounters::histogramBucket(4us), Eq(3U));
+    ASSERT_THAT(StatisticsCounters::histogramBucket(1ms), Eq(10U));
+    ASSERT_THAT(StatisticsCounters::histogramBucket(-1us), Eq(0U));
+    ASSERT_THAT(StatisticsCounters::histogramBucket(24h), Eq(31U));
+}
+
+TEST(StatisticsCounters, AccumulatesDispatchLatencyAndHandlerDuration)
+{
+    StatisticsCounters counters;
+
+    counters.recordDispatch(3us, 1ms);
+    counters.recordDispatch(3us, 2ms);
+
+    auto statistics = counters.snapshot();
+    ASSERT_THAT(statistics.dispatchLatency[2], Eq(2U));
+    ASSERT_THAT(statistics.handlerDuration[10], Eq(1U));
+    ASSERT_THAT(statistics.handlerDuration[11], Eq(1U));
+    ASSERT_THAT(statistics.handlerTime, Eq(3ms));
+}
+
+TEST(StatisticsCounters, KeepsLargestQueueLengths)
+{
+    StatisticsCounters counters;
+
+    counters.recordQueueLengths(2, 7);
+    counters.recordQueueLengths(5, 1);
+    counters.recordQueueLengths(0, 0);
+
+    auto statistics = counters.snapshot();
+    ASSERT_THAT(statistics.maxReadQueueLength, Eq(5U));
+    ASSERT_THAT(statistics.maxWriteQueueLength, Eq(7U));
+}
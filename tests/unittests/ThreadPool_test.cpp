@@ -0,0 +1,177 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file ThreadPool_test.cpp
+ *
+ * Created on: Oct 18, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ThreadPool.h"
+#include <sdbus-c++/Error.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using ::testing::Eq;
+using ::testing::Ne;
+using sdbus::internal::ThreadPool;
+using sdbus::internal::TaskGroup;
+using sdbus::internal::Strand;
+using namespace std::chrono_literals;
+
+/*-------------------------------------*/
+/* --          TEST CASES           -- */
+/*-------------------------------------*/
+
+TEST(ThreadPool, ThrowsErrorWhenCreatedWithZeroThreads)
+{
+    ASSERT_THROW(ThreadPool{0}, sdbus::Error);
+}
+
+TEST(ThreadPool, RunsAllPostedTasksBeforeDestruction)
+{
+    std::atomic<int> counter{};
+
+    {
+        ThreadPool pool{4};
+        for (int i = 0; i < 1000; ++i)
+            pool.post([&](){ ++counter; });
+    }
+
+    ASSERT_THAT(counter, Eq(1000));
+}
+
+TEST(ThreadPool, RunsTasksInWorkerThreads)
+{
+    std::thread::id taskThread;
+
+    {
+        ThreadPool pool{1};
+        pool.post([&](){ taskThread = std::this_thread::get_id(); });
+    }
+
+    ASSERT_THAT(taskThread, Ne(std::thread::id{}));
+    ASSERT_THAT(taskThread, Ne(std::this_thread::get_id()));
+}
+
+TEST(ThreadPool, KeepsRunningTasksAfterTaskThrows)
+{
+    std::atomic<int> counter{};
+
+    {
+        ThreadPool pool{1};
+        pool.post([](){ throw std::runtime_error("Error"); });
+        pool.post([&](){ ++counter; });
+    }
+
+    ASSERT_THAT(counter, Eq(1));
+}
+
+TEST(ThreadPool, StealsTasksFromBusyWorker)
+{
+    ThreadPool pool{2};
+    std::atomic<bool> release{};
+    std::atomic<bool> done{};
+    TaskGroup tasks;
+
+    // The first task occupies one worker, and posts the second task to its own queue from within it
+    tasks.post(pool, [&]()
+    {
+        tasks.post(pool, [&](){ done = true; });
+        while (!release)
+            std::this_thread::sleep_for(1ms);
+    });
+
+    for (int i = 0; i < 1000 && !done; ++i)
+        std::this_thread::sleep_for(1ms);
+    release = true;
+    tasks.wait();
+
+    ASSERT_TRUE(done);
+}
+
+TEST(TaskGroup, WaitsForAllItsTasksToFinish)
+{
+    ThreadPool pool{4};
+    std::atomic<int> counter{};
+    TaskGroup tasks;
+
+    for (int i = 0; i < 100; ++i)
+        tasks.post(pool, [&](){ std::this_thread::sleep_for(1ms); ++counter; });
+    tasks.wait();
+
+    ASSERT_THAT(counter, Eq(100));
+}
+
+TEST(Strand, RunsItsTasksInOrderOneAtATime)
+{
+    std::vector<int> order;
+    std::atomic<int> runningTasks{};
+    std::atomic<bool> overlapped{};
+
+    {
+        ThreadPool pool{4};
+        Strand strand;
+        for (int i = 0; i < 1000; ++i)
+        {
+            strand.post(pool, [&, i]()
+            {
+                if (++runningTasks > 1)
+                    overlapped = true;
+                order.push_back(i);
+                --runningTasks;
+            });
+        }
+    }
+
+    ASSERT_FALSE(overlapped);
+    ASSERT_THAT(order.size(), Eq(1000));
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_THAT(order[i], Eq(i));
+}
+
+TEST(Strand, RunsTasksOfDifferentStrandsInParallel)
+{
+    ThreadPool pool{2};
+    Strand strand1;
+    Strand strand2;
+    std::atomic<bool> firstStarted{};
+    std::atomic<bool> secondDone{};
+    TaskGroup tasks;
+
+    // The first strand's task only finishes after the second strand's task has run
+    strand1.post(pool, tasks.track([&]()
+    {
+        firstStarted = true;
+        for (int i = 0; i < 1000 && !secondDone; ++i)
+            std::this_thread::sleep_for(1ms);
+    }));
+    while (!firstStarted)
+        std::this_thread::sleep_for(1ms);
+    strand2.post(pool, tasks.track([&](){ secondDone = true; }));
+    tasks.wait();
+
+    ASSERT_TRUE(secondDone);
+}
@@ -231,3 +231,24 @@ TEST(FreeFunctionTypeTraits, DetectsTraitsOfAsyncFunction)
     static_assert(sdbus::function_argument_count_v<Fnc> == 3, "Incorrectly detected free function parameter count");
     static_assert(std::is_same_v<sdbus::function_result_t<Fnc>, std::tuple<char, int>>, "Incorrectly detected free function return type");
 }
+
+TEST(BorrowsMessageDataTypeTrait, DetectsStringViewsEvenWhenNestedInContainers)
+{
+    static_assert(sdbus::borrows_message_data_v<std::string_view>, "String view not detected");
+    static_assert(sdbus::borrows_message_data_v<const std::string_view>, "Const string view not detected");
+    static_assert(sdbus::borrows_message_data_v<std::vector<std::string_view>>, "String view in vector not detected");
+    static_assert(sdbus::borrows_message_data_v<std::array<std::string_view, 2>>, "String view in array not detected");
+    static_assert(sdbus::borrows_message_data_v<std::map<int32_t, std::vector<std::string_view>>>, "String view in nested container not detected");
+    static_assert(sdbus::borrows_message_data_v<sdbus::Struct<int32_t, std::string_view>>, "String view in struct not detected");
+    static_assert(sdbus::borrows_message_data_v<int32_t, std::variant<int32_t, std::string_view>>, "String view in variant not detected");
+    static_assert(!sdbus::borrows_message_data_v<std::string, sdbus::Variant, std::map<std::string, std::vector<int32_t>>>, "Owning types incorrectly detected");
+    static_assert(!sdbus::borrows_message_data_v<>, "Empty pack incorrectly detected");
+}
+
+TEST(BorrowsMessageDataTypeTrait, DetectsSpansOfConstElements)
+{
+    static_assert(sdbus::borrows_message_data_v<std::span<const uint8_t>>, "Span of const elements not detected");
+    static_assert(sdbus::borrows_message_data_v<std::span<const double, 4>>, "Fixed-extent span of const elements not detected");
+    static_assert(sdbus::borrows_message_data_v<std::vector<std::span<const int32_t>>>, "Span of const elements in vector not detected");
+    static_assert(!sdbus::borrows_message_data_v<std::span<int32_t>>, "Span of mutable elements, filled with a copy, incorrectly detected");
+}
@@ -33,11 +33,14 @@
 #include <gmock/gmock.h>
 #include <cstdint>
 #include <cerrno>
+#include <cstring>
+#include <fcntl.h>
 #include <map>
 #include <string>
 #include <variant>
 #include <vector>
 #include <sys/eventfd.h>
+#include <sys/mman.h>
 #include <tuple>
 #include <type_traits>
 #include <unistd.h>
@@ -45,6 +48,9 @@
 
 using ::testing::Eq;
 using ::testing::Gt;
+using ::testing::Ne;
+using ::testing::IsNull;
+using ::testing::ElementsAreArray;
 using ::testing::HasSubstr;
 using namespace std::string_literals;
 
@@ -331,6 +337,51 @@ TEST(CopiesOfVariant, SerializeToAndDeserializeFromMessageSuccessfully)
     ASSERT_THAT(receivedVariant3.get<ComplexType>(), Eq(value));
 }
 
+TEST(ASimpleVariant, ThrowsWhenAskedForValueOfTypeItDoesntReallyContain)
+{
+    const sdbus::Variant variant(5);
+
+    ASSERT_THROW(variant.get<std::string>(), sdbus::Error);
+}
+
+TEST(ASimpleVariant, ReturnsTheSimpleValueAfterBeingDeserializedFromAMessage)
+{
+    const sdbus::Variant variants[] = { sdbus::Variant(true) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+                                      , sdbus::Variant(uint8_t{255})
+                                      , sdbus::Variant(int16_t{-12345})
+                                      , sdbus::Variant(uint16_t{54321})
+                                      , sdbus::Variant(int32_t{-123456789})
+                                      , sdbus::Variant(uint32_t{3456789012})
+                                      , sdbus::Variant(int64_t{-1234567890123456789})
+                                      , sdbus::Variant(ANY_UINT64)
+                                      , sdbus::Variant(ANY_DOUBLE)
+                                      , sdbus::Variant("a string which is too long for small string optimization"s)
+                                      , sdbus::Variant(sdbus::ObjectPath{"/some/path"})
+                                      , sdbus::Variant(sdbus::Signature{"a{sv}"}) };
+
+    auto msg = sdbus::createPlainMessage();
+    for (const auto& variant : variants)
+        variant.serializeTo(msg);
+    msg.seal();
+    std::vector<sdbus::Variant> received(std::size(variants));
+    for (auto& variant : received)
+        variant.deserializeFrom(msg);
+
+    ASSERT_THAT(received[0].get<bool>(), Eq(true));
+    ASSERT_THAT(received[1].get<uint8_t>(), Eq(255));
+    ASSERT_THAT(received[2].get<int16_t>(), Eq(-12345));
+    ASSERT_THAT(received[3].get<uint16_t>(), Eq(54321));
+    ASSERT_THAT(received[4].get<int32_t>(), Eq(-123456789));
+    ASSERT_THAT(received[5].get<uint32_t>(), Eq(3456789012));
+    ASSERT_THAT(received[6].get<int64_t>(), Eq(-1234567890123456789));
+    ASSERT_THAT(received[7].get<uint64_t>(), Eq(ANY_UINT64));
+    ASSERT_THAT(received[8].get<double>(), Eq(ANY_DOUBLE));
+    ASSERT_THAT(received[9].get<std::string>(), Eq("a string which is too long for small string optimization"));
+    ASSERT_THAT(received[10].get<sdbus::ObjectPath>(), Eq("/some/path"));
+    ASSERT_THAT(received[11].get<sdbus::Signature>(), Eq("a{sv}"));
+    ASSERT_TRUE(received[10].containsValueOfType<sdbus::ObjectPath>());
+}
+
 TEST(AStruct, CanBeCreatedFromStdTuple)
 {
     std::tuple<int32_t, std::string> value{1234, "abcd"};
@@ -511,6 +562,80 @@ TEST(AUnixFd, TakesOverNewFdAndClosesOriginalFdOnAdoptingReset)
     EXPECT_THAT(::close(fd), Eq(-1));
 }
 
+TEST(ASharedBuffer, IsEmptyWhenDefaultConstructed)
+{
+    sdbus::SharedBuffer buffer;
+
+    EXPECT_THAT(buffer.size(), Eq(0U));
+    EXPECT_THAT(buffer.data(), IsNull());
+    EXPECT_FALSE(buffer.isShared());
+}
+
+TEST(ASharedBuffer, KeepsDataBelowInlineThresholdInline)
+{
+    const std::vector<uint8_t> data{1, 2, 3};
+
+    sdbus::SharedBuffer buffer{data.data(), data.size()};
+
+    EXPECT_FALSE(buffer.isShared());
+    EXPECT_THAT(std::vector(buffer.data(), buffer.data() + buffer.size()), ElementsAreArray(data));
+}
+
+TEST(ASharedBuffer, PutsDataOfInlineThresholdSizeIntoASealedMemfd)
+{
+    const std::vector<uint8_t> data(sdbus::SharedBuffer::DEFAULT_INLINE_THRESHOLD, 7);
+
+    sdbus::SharedBuffer buffer{data.data(), data.size()};
+
+    ASSERT_TRUE(buffer.isShared());
+    EXPECT_THAT(::fcntl(buffer.getFd().get(), F_GET_SEALS) & (F_SEAL_WRITE | F_SEAL_SHRINK), Eq(F_SEAL_WRITE | F_SEAL_SHRINK));
+    EXPECT_THAT(std::vector(buffer.data(), buffer.data() + buffer.size()), ElementsAreArray(data));
+}
+
+TEST(ASharedBuffer, LetsTheWriterFillTheMemfdInPlace)
+{
+    auto buffer = sdbus::SharedBuffer::create(8, [](void* data){ std::memset(data, 'x', 8); }, 1);
+
+    ASSERT_TRUE(buffer.isShared());
+    EXPECT_THAT(std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size()), Eq("xxxxxxxx"));
+}
+
+TEST(ASharedBuffer, SharesTheDataWithItsCopies)
+{
+    const std::vector<uint8_t> data(16, 7);
+    sdbus::SharedBuffer buffer{data.data(), data.size(), 1};
+
+    auto copy = buffer;
+
+    EXPECT_THAT(copy.data(), Eq(buffer.data()));
+    EXPECT_THAT(copy.getFd().get(), Ne(buffer.getFd().get()));
+}
+
+TEST(ASharedBuffer, MapsASealedMemfd)
+{
+    sdbus::SharedBuffer original{"abc", 3, 1};
+
+    sdbus::SharedBuffer buffer{original.getFd()};
+
+    EXPECT_THAT(std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size()), Eq("abc"));
+}
+
+TEST(ASharedBuffer, ThrowsWhenGivenAnUnsealedMemfd)
+{
+    sdbus::UnixFd fd{::memfd_create("test", MFD_CLOEXEC | MFD_ALLOW_SEALING), sdbus::adopt_fd};
+    ASSERT_THAT(::ftruncate(fd.get(), 3), Eq(0));
+
+    ASSERT_THROW(sdbus::SharedBuffer{fd}, sdbus::Error);
+}
+
+TEST(ASharedBuffer, ThrowsWhenGivenAMemfdLargerThanTheMaximumSize)
+{
+    sdbus::SharedBuffer original{"abcd", 4, 1};
+
+    ASSERT_THROW(sdbus::SharedBuffer(original.getFd(), 3), sdbus::Error);
+    ASSERT_NO_THROW(sdbus::SharedBuffer(original.getFd(), 4));
+}
+
 TEST(AnError, CanBeConstructedFromANameAndAMessage)
 {
     auto error = sdbus::Error(sdbus::Error::Name{"org.sdbuscpp.error"}, "message");
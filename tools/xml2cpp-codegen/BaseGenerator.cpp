@@ -106,6 +106,25 @@ std::tuple<unsigned, std::string> BaseGenerator::generateNamespaces(const std::s
 }
 
 
+std::string BaseGenerator::argToType(Node& arg) const
+{
+    auto signature = arg.get("type");
+
+    for (const auto& annotation : arg["annotation"])
+    {
+        if (annotation->get("name") != "org.sdbuscpp.SharedBuffer" || annotation->get("value") != "true")
+            continue;
+
+        if (signature == "v")
+            return "sdbus::SharedBuffer";
+
+        std::cerr << "Arg: " << arg.get("name") << ": "
+                  << "Option 'org.sdbuscpp.SharedBuffer' allowed only on args of type 'v'! Option ignored..." << std::endl;
+    }
+
+    return signature_to_type(signature);
+}
+
 std::tuple<std::string, std::string, std::string, std::string> BaseGenerator::argsToNamesAndTypes(const Nodes& args, bool async) const
 {
     std::ostringstream argSS, argTypeSS, typeSS, argStringsSS;
@@ -127,7 +146,7 @@ std::tuple<std::string, std::string, std::string, std::string> BaseGenerator::ar
             argName = "arg" + std::to_string(i);
         }
         auto argNameSafe = mangle_name(argName);
-        auto type = signature_to_type(arg->get("type"));
+        auto type = argToType(*arg);
         argStringsSS << "\"" << argName << "\"";
         if (!async)
         {
@@ -162,7 +181,7 @@ std::string BaseGenerator::outArgsToType(const Nodes& args, bool bareList) const
     else if (args.size() == 1)
     {
         const auto& arg = *args.begin();
-        retTypeSS << signature_to_type(arg->get("type"));
+        retTypeSS << argToType(*arg);
     }
     else if (args.size() >= 2)
     {
@@ -173,7 +192,7 @@ std::string BaseGenerator::outArgsToType(const Nodes& args, bool bareList) const
         for (const auto& arg : args)
         {
             if (firstArg) firstArg = false; else retTypeSS << ", ";
-            retTypeSS << signature_to_type(arg->get("type"));
+            retTypeSS << argToType(*arg);
         }
 
         if (!bareList)
@@ -83,6 +83,13 @@ protected:
      */
     std::tuple<unsigned, std::string> generateNamespaces(const std::string& ifaceName) const;
 
+    /**
+     * C++ type of an argument, taking its annotations into account
+     * @param arg
+     * @return argument type
+     */
+    std::string argToType(sdbuscpp::xml::Node& arg) const;
+
     /**
      * Transform arguments into source code
      * @param args